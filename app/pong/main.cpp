@@ -17,6 +17,7 @@
 /***************************************************************************************************/
 
 #include <APLcore.h>
+#include <APLsprite.h>
 #include "tile.h"
 #include "APLtile.h"
 
@@ -33,17 +34,15 @@ void scrollingDemo();	// forward declaration
 
 APLcore INSTANCE;
 APLcore* pAPL = NULL;
+APLsprite sprites(&INSTANCE);
 uint8_t scrViewWidthInTile = 0;
 
-// RAM tile the custom rendering
-uint8_t RAM_Tile[TileMemSize];
-uint8_t* BallTile = RAM_Tile;
+#define BALL_SPRITE 0
 
 // PGM tile pointer init
 const uint8_t* Black = (const uint8_t*)&Tile[TileMemSize * tile_empty];
 const uint8_t* PaddleL = &Tile[TileMemSize * tile_paddle_left];
 const uint8_t* Net = &Tile[TileMemSize * tile_net];
-uint8_t* ballBackgroundTile = (uint8_t*)Black;
 uint8_t* paddleBackgroundTile = (uint8_t*)Black;
 
 signed char Paddle_y = scrViewHeightInTile/2;
@@ -93,37 +92,29 @@ int main() {
 	scrViewWidthInTile = pAPL->getscrViewWidthInTile();
 	Ball_tile_x =scrViewWidthInTile/2, Ball_tile_y = scrViewHeightInTile/2;
 	// clear screen
-	for(uint8_t y=0; y<scrViewHeightInTile; y++) {
-		for (uint8_t x=0; x<scrViewWidthInTile; x++) {
-			pAPL->setTileXY(x, y, (uint8_t *)Black);
-		}
-	}
+	pAPL->fillTiles(0, 0, scrViewWidthInTile, scrViewHeightInTile, (uint8_t *)Black);
 
 	// draw the horizontal frame
-	for (uint8_t x=0; x<scrViewWidthInTile; x++) {
-		pAPL->setTileXY(x, 0, (uint8_t *)&Tile[TileMemSize * tile_top_border]);
-		pAPL->setTileXY(x, scrViewHeightInTile-1, (uint8_t *)&Tile[TileMemSize * tile_bottom_border]);
-	}
+	pAPL->fillTiles(0, 0, scrViewWidthInTile, 1, (uint8_t *)&Tile[TileMemSize * tile_top_border]);
+	pAPL->fillTiles(0, scrViewHeightInTile-1, scrViewWidthInTile, 1, (uint8_t *)&Tile[TileMemSize * tile_bottom_border]);
 	// draw the vertical frame
-	for(uint8_t y=0; y<scrViewHeightInTile; y++) {
-		pAPL->setTileXY(0, y, (uint8_t *)&Tile[TileMemSize * tile_left_border]);
-		pAPL->setTileXY(scrViewWidthInTile-1, y, (uint8_t *)&Tile[TileMemSize * tile_right_border]);
-	}
+	pAPL->fillTiles(0, 0, 1, scrViewHeightInTile, (uint8_t *)&Tile[TileMemSize * tile_left_border]);
+	pAPL->fillTiles(scrViewWidthInTile-1, 0, 1, scrViewHeightInTile, (uint8_t *)&Tile[TileMemSize * tile_right_border]);
 	// draw the 4 corners
 	pAPL->setTileXY(0, 0, (uint8_t *)&Tile[TileMemSize * tile_top_left_corner]);
 	pAPL->setTileXY(scrViewWidthInTile-1, 0, (uint8_t *)&Tile[TileMemSize * tile_top_right_corner]);
 	pAPL->setTileXY(0, scrViewHeightInTile-1, (uint8_t *)&Tile[TileMemSize * tile_bottom_left_corner]);
 	pAPL->setTileXY(scrViewWidthInTile-1, scrViewHeightInTile-1, (uint8_t *)&Tile[TileMemSize * tile_right_bottom_corner]);   
 	// draw the paddle
-	paddleBackgroundTile = pAPL->getTileXY(0, Paddle_y);
-	pAPL->setTileXY(0, Paddle_y, (uint8_t *)PaddleL); 
+	paddleBackgroundTile = sprites.getTileXY(0, Paddle_y);
+	sprites.setTileXY(0, Paddle_y, (uint8_t *)PaddleL); 
 	// draw the net
-	for(uint8_t y=1; y<scrViewHeightInTile-1; y++) {
-		pAPL->setTileXY(scrViewWidthInTile/2, y, (uint8_t *)Net); 
-	}
+	pAPL->fillTiles(scrViewWidthInTile/2, 1, 1, scrViewHeightInTile-2, (uint8_t *)Net);
   
-	// init the background tile at ball position  
-	ballBackgroundTile = pAPL->getTileXY(Ball_tile_x, Ball_tile_y);
+	// draw the ball
+	sprites.setSprite(BALL_SPRITE, BallSprite);
+	sprites.moveSprite(BALL_SPRITE, Ball_tile_x*8 + Ball_x, Ball_tile_y*8 + Ball_y);
+	sprites.update();
 
 
 	while(1) {  
@@ -174,9 +165,9 @@ int main() {
 			if (Paddle_y < 0) Paddle_y = 0;
     
 			if (Paddle_y != paddle) {
-				pAPL->setTileXY(0, paddle, paddleBackgroundTile); // restore tile where was the paddle on the screen       
-				paddleBackgroundTile = pAPL->getTileXY(0, Paddle_y); // save the current tile
-				pAPL->setTileXY(0, Paddle_y, (uint8_t *)PaddleL); // redraw the paddle on the screen
+				sprites.setTileXY(0, paddle, paddleBackgroundTile); // restore tile where was the paddle on the screen       
+				paddleBackgroundTile = sprites.getTileXY(0, Paddle_y); // save the current tile
+				sprites.setTileXY(0, Paddle_y, (uint8_t *)PaddleL); // redraw the paddle on the screen
 			}
 		}
     
@@ -223,40 +214,18 @@ int main() {
 			Ball_y = MAX_BALL_Y; tmpy--; // move to the next tile top
 		}
 
-		// restore the tile where was the ball on the screen
-		pAPL->setTileXY(Ball_tile_x, Ball_tile_y, ballBackgroundTile);
-  
-		// get the background tile at new ball position  
+		// move the ball, the sprite engine restores and composes the tiles
 		Ball_tile_x = tmpx;
 		Ball_tile_y = tmpy;
-		uint8_t* p = ballBackgroundTile = pAPL->getTileXY(Ball_tile_x, Ball_tile_y);
-		for(uint8_t y=0; y<TileMemSize; y++) {
-			BallTile[y] = pgm_read_byte(p++);
-		}  
-		// overlay the ball
-#ifdef PIXEL_HW_MUX
-		switch (Ball_x) {
-			case 0: BallTile[Ball_y*TileMemWidth+0] |= 0b11100000; break;
-			case 1: BallTile[Ball_y*TileMemWidth+0] |= 0b00011100; break;
-			case 2: BallTile[Ball_y*TileMemWidth+1] |= 0b11100000; break;
-			case 3: BallTile[Ball_y*TileMemWidth+1] |= 0b00011100; break;
-			case 4: BallTile[Ball_y*TileMemWidth+2] |= 0b11100000; break;
-			case 5: BallTile[Ball_y*TileMemWidth+2] |= 0b00011100; break;
-			case 6: BallTile[Ball_y*TileMemWidth+3] |= 0b11100000; break;
-			case 7: BallTile[Ball_y*TileMemWidth+3] |= 0b00011100; break;
-		}
-#else
-		BallTile[Ball_y] |= 1 << (MAX_BALL_X - Ball_x);
-#endif
-
-		pAPL->setRAMTileXY(Ball_tile_x, Ball_tile_y, BallTile); // draw the ball on the screen
+		sprites.moveSprite(BALL_SPRITE, Ball_tile_x*8 + Ball_x, Ball_tile_y*8 + Ball_y);
+		sprites.update();
 
 		while(t+25 > pAPL->ms_elpased()); // 25 ms periodic refresh
 	}
 }
 
 void scrollingDemo() {
-   signed char xAPL = 0, yAPL = 0;
+   signed char xAPL = 0;
 #ifdef PIXEL_HW_MUX
    pAPL->initScreenBuffer(GraphMode);      // 8 colors in Graph mode      
 #else   
@@ -270,18 +239,13 @@ void scrollingDemo() {
     
     // splash screen (20 by 20 tiles)
     const uint8_t xSize = 20, ySize = 20;
-    for(uint8_t y=0; y<scrHeightInTile; y++) {
-        for (uint8_t x=0; x<scrWidthInTile; x++) {
-            unsigned int yy = y;
-            unsigned int i = yy * xSize + x;                        
-            if ((yy >= ySize) || (x >= xSize)) { // fillout when exceed image
-                yy = ySize-1;
-                i = yy * xSize + xSize-1;
-            }            
-			//pAPL->setTileXY(x, y, (uint8_t *)&PETtile2B[TileMemSize * i]); // 4 colors
-			pAPL->setTileXY(x, y, (uint8_t *)&TILEimage[TileMemSize4B * i]); // 8 colors
-        }
-    }
+    const uint8_t w = (scrWidthInTile < xSize) ? scrWidthInTile : xSize;
+    const uint8_t h = (scrHeightInTile < ySize) ? scrHeightInTile : ySize;
+    uint8_t* pFillTile = (uint8_t *)&TILEimage[TileMemSize4B * (ySize * xSize - 1)]; // fillout when exceed image
+    //pAPL->blitTileMap(0, 0, w, h, NULL, xSize, PETtile2B, TileMemSize); // 4 colors
+    pAPL->blitTileMap(0, 0, w, h, NULL, xSize, TILEimage, TileMemSize4B); // 8 colors
+    pAPL->fillTiles(w, 0, scrWidthInTile-w, scrHeightInTile, pFillTile);
+    pAPL->fillTiles(0, h, w, scrHeightInTile-h, pFillTile);
 
     signed char dirX = 1;
     signed char dirY = 15;
@@ -293,8 +257,9 @@ void scrollingDemo() {
             case UPARROW : yAPL+=1; break;          
         }*/
         
-        if (dirY > 0) { dirY++; yAPL++; }
-        else { dirY--; yAPL--; }
+        uint8_t yStep = (dirY > 0) ? 1 : scrHeightInTile*TileMemHeight - 1; // 1 pixel up or down, wrapped around the rows
+        if (dirY > 0) dirY++;
+        else dirY--;
         
         if (dirX > 0) { dirX++; xAPL++; }
         else { dirX--; xAPL--; }
@@ -306,29 +271,8 @@ void scrollingDemo() {
         
         pAPL->ms_delay(20); // slow down
                 
-        // --------------- vertical up/down shift (by APL) --------------------------//
-        if(yAPL <= -1) {
-            uint8_t* pArray[scrWidthInTile];
-            for(uint8_t x=0; x<scrWidthInTile; x++) {
-                pArray[x] = pAPL->getTileXY(x, scrHeightInTile-1); // save bottom row (last scrolling row used in scrolling)
-            }
-            yAPL = 7; pAPL->setYScroll(yAPL); pAPL->shiftDownTile();
-            for(uint8_t x=0; x<scrWidthInTile; x++) {
-                pAPL->setTileXY(x, 0, pArray[x]); // restore
-            }
-            
-        }
-        if(yAPL >= 8) {
-            uint8_t* pArray[scrWidthInTile];
-            for(uint8_t x=0; x<scrWidthInTile; x++) {
-                pArray[x] = pAPL->getTileXY(x, 0); // save top row (last scrolling row used in scrolling)
-            }
-            yAPL = 0; pAPL->setYScroll(yAPL); pAPL->shiftUpTile();
-            for(uint8_t x=0; x<scrWidthInTile; x++) {
-                pAPL->setTileXY(x, scrHeightInTile-1, pArray[x]); // restore
-            }           
-        }
-        pAPL->setYScroll(yAPL);
+        // --------------- vertical up/down scroll (by APL origin, the rows wrap around) --------------------------//
+        pAPL->scrollUp(yStep);
     
         // --------------- horizontal left/right shift (by APL) --------------------------//
         if(xAPL <= -1) {
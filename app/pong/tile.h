@@ -143,6 +143,18 @@ const uint8_t Tile[] PROGMEM = {
   0b10000000,0b00000000,0b00000000,0b00000000,
   0b10000000,0b00000000,0b00000000,0b00000000
 };  //  end of tile
+
+// ball sprite (black pixels are transparent)
+const uint8_t BallSprite[] PROGMEM = {
+  0b11111100,0b00000000,0b00000000,0b00000000,
+  0b11111100,0b00000000,0b00000000,0b00000000,
+  0b00000000,0b00000000,0b00000000,0b00000000,
+  0b00000000,0b00000000,0b00000000,0b00000000,
+  0b00000000,0b00000000,0b00000000,0b00000000,
+  0b00000000,0b00000000,0b00000000,0b00000000,
+  0b00000000,0b00000000,0b00000000,0b00000000,
+  0b00000000,0b00000000,0b00000000,0b00000000
+};
 #else
 // 4 colors (default RED+GREEN) tile definition
 const uint8_t Tile[] PROGMEM = {
@@ -255,6 +267,18 @@ const uint8_t Tile[] PROGMEM = {
   0b11000000, 0b00000000,
   0b11000000, 0b00000000
 };  //  end of tile
+
+// ball sprite (black pixels are transparent)
+const uint8_t BallSprite[] PROGMEM = {
+  0b11110000, 0b00000000,
+  0b11110000, 0b00000000,
+  0b00000000, 0b00000000,
+  0b00000000, 0b00000000,
+  0b00000000, 0b00000000,
+  0b00000000, 0b00000000,
+  0b00000000, 0b00000000,
+  0b00000000, 0b00000000
+};
 #endif
 
 const uint8_t sound_intro[] PROGMEM = {
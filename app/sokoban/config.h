@@ -23,7 +23,17 @@
 #define F_CPU 32000000UL  // system clock
 #define PIXEL_HW_MUX      // this define enables the Pixel Hardware Mux
 
-//#define NO_XSCROLLING		// use this define to disable the x scrolling feature in GraphMode (1 tile resolution could increased)
+//#define NO_XSCROLLING		// use this define to disable the x scrolling feature in GraphMode (the saved cycles may give one more tile column)
+//#define SCREEN_INDEX_MAP	// use this define for a tile index screen buffer (half RAM, tiles from the tileset set by setTileset())
+//#define SCREEN_DOUBLE_BUFFER	// use this define with SCREEN_INDEX_MAP to compose the screen in a back page displayed by present()
+//#define SCANLINE_RENDER	// use this define to render GraphMode from a RAM line buffer with the sprites set by setLineSprite() (fewer GraphMode tile columns, 24 MHz at least)
+//#define TILE_HEIGHT_16	// use this define for 8 by 16 pixels tiles (half the tile rows, the 8 pixels font lines are doubled)
+//#define SCREEN_240_LINES	// use this define with SCREEN_INDEX_MAP to select 240 lines (30 tile rows) by initScreenBuffer(mode, verticalScaling240)
+//#define SLEEP_SYNC		// use this define when the main loop waits in waitLine() between the lines (no Timer0 jitter fix, Timer0 left free)
+//#define RASTER_EFFECTS	// use this define for the per tile row scrolling, color and mode, the split, the line map and the raster callback (fewer tile columns)
+//#define RASTER_BUDGET 128	// use this define with RASTER_EFFECTS to reserve the cycles of the raster callback on every active line (fewer tile columns)
+//#define ISR_PROFILE		// use this define to measure the ISR cycles by getPhaseCycles() and getMainCycles() (a few cycles on every line)
+//#define VGA_TIMING VGA_640x400_70	// use this define to select the VGA timing profile (VGA_640x480_60 by default, VGA_800x600_56, VGA_640x400_70, VGA_720x400_70)
 //================================ Hardware Config (end) ==========================================//
 
 #endif
@@ -127,12 +127,10 @@ int main() {
 	xPos=12; yPos=11; heading = RIGHTARROW;
 	
 	// get the the ROM map
-	for (unsigned char y=0; y<SCREEN_SIZE_ROW; y++) {
-		for (unsigned char x=0; x<SCREEN_SIZE_COL; x++) {
-			unsigned int i = (unsigned int)y*SCREEN_SIZE_COL + x;
-			updateMap(map, x, y, pgm_read_byte((unsigned char*)SOKOmap_L1 + i));
-		}
+	for (unsigned int i=0; i<MAP_SIZE; i++) {
+		map[i] = pgm_read_byte((unsigned char*)SOKOmap_L1 + i);
 	}
+	pAPL->blitTileMap(0, 0, SCREEN_SIZE_COL, SCREEN_SIZE_ROW, SOKOmap_L1, SCREEN_SIZE_COL, SOKOtile, TileMemSize4B);
 	
 	// add the man
 	updateMap(map, xPos, yPos, iMAN_STANDING);
@@ -0,0 +1,94 @@
+/***************************************************************************************************/
+/*                                                                                                 */
+/* file:          APLattr.cpp                                                                      */
+/*                                                                                                 */
+/* source:        2018-2025, written by Adrian Kundert (adrian.kundert@gmail.com)                  */
+/*                                                                                                 */
+/* description:   APL attribute tiles: 1 bit glyphs colored into a cache of RAM tiles              */
+/*                                                                                                 */
+/* This library is free software; you can redistribute it and/or modify it under the terms of the  */
+/* GNU Lesser General Public License as published by the Free Software Foundation;                 */
+/* either version 2.1 of the License, or (at your option) any later version.                       */
+/*                                                                                                 */
+/* This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;       */
+/* without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.       */
+/* See the GNU Lesser General Public License for more details.                                     */
+/*                                                                                                 */
+/***************************************************************************************************/
+
+#ifdef ATMEL_STUDIO
+	#include <avr/pgmspace.h>
+	#define NULL 0
+#endif
+#include "APLattr.h"
+
+#pragma GCC optimize ("-O3") // speed optimization
+
+APLattr::APLattr(APLcore* pAPL, const uint8_t* glyphs, uint8_t* pool, uint8_t tiles) {
+	this->pAPL = pAPL;
+	this->glyphs = glyphs;
+	cacheSize = tiles;
+	cacheTile = pool;
+	cache = (CacheEntry*)(pool + (unsigned int)tiles * TileMemSize);
+	for (uint8_t e = 0; e < cacheSize; e++) {
+		cache[e].valid = cache[e].used = false;
+	}
+}
+
+bool APLattr::setAttrTileXY(uint8_t x, uint8_t y, uint8_t glyph, uint8_t attr) {
+	uint8_t e = findEntry(glyph, attr);
+	if (e == cacheSize) {
+		// the entries not on the screen any more are reused
+		collect();
+		for (e = 0; e < cacheSize; e++) {
+			if (cache[e].used == false) break;
+		}
+		if (e == cacheSize) return false;	// cache full
+		cache[e].glyph = glyph;
+		cache[e].attr = attr;
+		cache[e].valid = true;
+		colorTile(e);
+	}
+	cache[e].used = true;
+	pAPL->setRAMTileXY(x, y, cacheTile + (unsigned int)e * TileMemSize);
+	return true;
+}
+
+// returns cacheSize when the colored tile is not in the cache
+uint8_t APLattr::findEntry(uint8_t glyph, uint8_t attr) {
+	for (uint8_t e = 0; e < cacheSize; e++) {
+		if (cache[e].valid && (cache[e].glyph == glyph) && (cache[e].attr == attr)) return e;
+	}
+	return cacheSize;
+}
+
+// marks the entries on the screen buffer, including the rows and columns out of the view (a PGM tile address may keep an entry)
+void APLattr::collect() {
+	uint8_t* pEnd = cacheTile + (unsigned int)cacheSize * TileMemSize;
+	for (uint8_t e = 0; e < cacheSize; e++) cache[e].used = false;
+	for (uint8_t y = 0; y <= pAPL->getscrViewHeightInTile(); y++) {
+		for (uint8_t x = 0; x < scrBufWidthInTile; x++) {
+			uint8_t* pTile = pAPL->getTileXY(x, y);
+			if ((pTile < cacheTile) || (pTile >= pEnd)) continue;
+			cache[(unsigned int)(pTile - cacheTile) / TileMemSize].used = true;
+		}
+	}
+}
+
+void APLattr::colorTile(uint8_t e) {
+	const uint8_t* pGlyph = glyphs + (unsigned int)cache[e].glyph * GlyphHeight;
+	uint8_t fg = cache[e].attr & TilePixMask;
+	uint8_t bg = (cache[e].attr >> 4) & TilePixMask;
+	uint8_t* pDst = cacheTile + (unsigned int)e * TileMemSize;
+	for (uint8_t row = 0; row < TileMemHeight; row++) {
+		uint8_t bits = pgm_read_byte(pGlyph + row / (TileMemHeight / GlyphHeight));	// doubled rows with TILE_HEIGHT_16
+		for (uint8_t col = 0; col < TilePixWidth; col += TilePixPerByte) {
+			uint8_t value = 0;
+			for (uint8_t p = 0; p < TilePixPerByte; p++) {
+				value |= ((bits & 0x80) ? fg : bg) << tilePixShift(p);
+				bits <<= 1;
+			}
+			*pDst++ = value;
+		}
+	}
+}
@@ -0,0 +1,67 @@
+/***************************************************************************************************/
+/*                                                                                                 */
+/* file:          APLattr.h                                                                        */
+/*                                                                                                 */
+/* source:        2018-2025, written by Adrian Kundert (adrian.kundert@gmail.com)                  */
+/*                                                                                                 */
+/* description:   APL attribute tiles: 1 bit glyphs colored into a cache of RAM tiles              */
+/*                                                                                                 */
+/* This library is free software; you can redistribute it and/or modify it under the terms of the  */
+/* GNU Lesser General Public License as published by the Free Software Foundation;                 */
+/* either version 2.1 of the License, or (at your option) any later version.                       */
+/*                                                                                                 */
+/* This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;       */
+/* without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.       */
+/* See the GNU Lesser General Public License for more details.                                     */
+/*                                                                                                 */
+/***************************************************************************************************/
+
+#ifndef APLattr_h
+#define APLattr_h
+
+#include "APLcore.h"
+
+// The glyphs are PGM tiles of 1 bit per pixel (GlyphHeight bytes, MSB on the left), e.g. PETglyph1B.
+// The GraphMode tiles are colored from the glyph and the attribute into a cache of RAM tiles, the screen
+// tiles of the same glyph and attribute share the cache tile. The cache tiles not on the screen any more
+// are reused when the cache is full. The cache is a RAM pool of attrCacheSize() bytes sized by the
+// application, up to one tile per distinct glyph and attribute on the screen buffer.
+// With TILE_HEIGHT_16, the glyph rows are doubled.
+// With SCREEN_INDEX_MAP, the cache tiles must be the RAM tileset (see getCacheTiles()).
+inline uint8_t tileAttr(uint8_t fg, uint8_t bg) {	// foreground and background pixel values (R,G,B from the MSB with PIXEL_HW_MUX)
+	return (fg & TilePixMask) | ((bg & TilePixMask) << 4);
+}
+
+class APLattr
+{
+	public:
+		static const uint8_t GlyphHeight = 8;	// glyph bytes
+		struct CacheEntry {
+			uint8_t glyph;
+			uint8_t attr;
+			bool valid;		// colored tile in the cache
+			bool used;		// on the screen, evaluated when the cache is full
+		};
+
+		APLattr(APLcore* pAPL, const uint8_t* glyphs, uint8_t* pool, uint8_t tiles);	///< pool of attrCacheSize(tiles) bytes
+		bool setAttrTileXY(uint8_t x, uint8_t y, uint8_t glyph, uint8_t attr);	///< at position (x,y), set the glyph colored by the attribute of tileAttr(), returns false when the cache is full
+		uint8_t* getCacheTiles() {
+			return cacheTile;
+		}
+	private:
+		uint8_t findEntry(uint8_t glyph, uint8_t attr);
+		void collect();
+		void colorTile(uint8_t e);
+	private:
+		APLcore* pAPL;
+		const uint8_t* glyphs;
+		uint8_t cacheSize;		// RAM tiles
+		uint8_t* cacheTile;		// pool tiles, followed by the entries
+		CacheEntry* cache;
+};
+
+inline unsigned int attrCacheSize(uint8_t tiles) {
+	return (unsigned int)tiles * (TileMemSize + sizeof(APLattr::CacheEntry));
+}
+
+#endif
@@ -0,0 +1,156 @@
+/***************************************************************************************************/
+/*                                                                                                 */
+/* file:          APLcanvas.cpp                                                                    */
+/*                                                                                                 */
+/* source:        2018-2025, written by Adrian Kundert (adrian.kundert@gmail.com)                  */
+/*                                                                                                 */
+/* description:   APL bitmap canvas drawn into a pool of RAM tiles                                 */
+/*                                                                                                 */
+/* This library is free software; you can redistribute it and/or modify it under the terms of the  */
+/* GNU Lesser General Public License as published by the Free Software Foundation;                 */
+/* either version 2.1 of the License, or (at your option) any later version.                       */
+/*                                                                                                 */
+/* This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;       */
+/* without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.       */
+/* See the GNU Lesser General Public License for more details.                                     */
+/*                                                                                                 */
+/***************************************************************************************************/
+
+#ifdef ATMEL_STUDIO
+	#include <avr/pgmspace.h>
+	#define NULL 0
+#endif
+#include "APLcanvas.h"
+
+#pragma GCC optimize ("-O3") // speed optimization
+
+APLcanvas::APLcanvas(APLcore* pAPL, uint8_t* pool, uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+	this->pAPL = pAPL;
+	this->pool = pool;
+	tileX = x; tileY = y;
+	tileW = w; tileH = h;
+	rowSize = (unsigned int)w * TileMemSize;
+}
+
+void APLcanvas::show() {
+	uint8_t* pTile = pool;
+	for (uint8_t j = 0; j < tileH; j++) {
+		for (uint8_t i = 0; i < tileW; i++) {
+			pAPL->setRAMTileXY(tileX + i, tileY + j, pTile);
+			pTile += TileMemSize;
+		}
+	}
+}
+
+// the pixel value repeated over a byte
+uint8_t APLcanvas::fillByte(uint8_t color) {
+	uint8_t value = 0;
+	for (uint8_t p = 0; p < TilePixPerByte; p++) value |= (color & TilePixMask) << tilePixShift(p);
+	return value;
+}
+
+uint8_t* APLcanvas::pixelByte(uint8_t x, uint8_t y) {
+	return pool + (y / TileMemHeight) * rowSize + (unsigned int)(x / TilePixWidth) * TileMemSize
+		+ (y & (TileMemHeight-1)) * TileMemWidth + (x & (TilePixWidth-1)) / TilePixPerByte;
+}
+
+void APLcanvas::clear(uint8_t color) {
+	uint8_t value = fillByte(color);
+	unsigned int size = rowSize * tileH;
+	for (unsigned int i = 0; i < size; i++) pool[i] = value;
+}
+
+void APLcanvas::putPixel(uint8_t x, uint8_t y, uint8_t color) {
+	if ((x >= getWidth()) || (y >= getHeight())) return;
+	uint8_t* p = pixelByte(x, y);
+	uint8_t shift = tilePixShift(x);
+	*p = (*p & ~(TilePixMask << shift)) | ((color & TilePixMask) << shift);
+}
+
+uint8_t APLcanvas::getPixel(uint8_t x, uint8_t y) {
+	if ((x >= getWidth()) || (y >= getHeight())) return 0;
+	return (*pixelByte(x, y) >> tilePixShift(x)) & TilePixMask;
+}
+
+void APLcanvas::hLine(uint8_t x, uint8_t y, uint8_t w, uint8_t color) {
+	if ((x >= getWidth()) || (y >= getHeight())) return;
+	uint8_t end = (w > getWidth() - x) ? getWidth() : x + w;
+	uint8_t value = fillByte(color);
+	uint8_t* pRow = pool + (y / TileMemHeight) * rowSize + (y & (TileMemHeight-1)) * TileMemWidth;
+	while (x < end) {
+		uint8_t col = x & (TilePixWidth-1);
+		uint8_t* p = pRow + (unsigned int)(x / TilePixWidth) * TileMemSize + col / TilePixPerByte;
+		if (((col & (TilePixPerByte-1)) == 0) && (end - x >= TilePixPerByte)) {
+			*p = value;		// whole byte
+			x += TilePixPerByte;
+		}
+		else {
+			uint8_t shift = tilePixShift(col);
+			*p = (*p & ~(TilePixMask << shift)) | (value & (TilePixMask << shift));
+			x++;
+		}
+	}
+}
+
+void APLcanvas::vLine(uint8_t x, uint8_t y, uint8_t h, uint8_t color) {
+	if ((x >= getWidth()) || (y >= getHeight())) return;
+	uint8_t end = (h > getHeight() - y) ? getHeight() : y + h;
+	uint8_t shift = tilePixShift(x);
+	uint8_t mask = ~(TilePixMask << shift);
+	uint8_t value = (color & TilePixMask) << shift;
+	uint8_t* p = pixelByte(x, y);
+	for (; y < end; y++) {
+		*p = (*p & mask) | value;
+		p += TileMemWidth;
+		if ((y & (TileMemHeight-1)) == TileMemHeight-1) p += rowSize - TileMemSize;	// first row of the tile below
+	}
+}
+
+void APLcanvas::line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t color) {
+	if (y0 == y1) {
+		if (x0 > x1) { uint8_t t = x0; x0 = x1; x1 = t; }
+		hLine(x0, y0, x1 - x0 + 1, color);
+		return;
+	}
+	if (x0 == x1) {
+		if (y0 > y1) { uint8_t t = y0; y0 = y1; y1 = t; }
+		vLine(x0, y0, y1 - y0 + 1, color);
+		return;
+	}
+	int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	int dy = (y1 > y0) ? y0 - y1 : y1 - y0;	// negative
+	int8_t sx = (x1 > x0) ? 1 : -1;
+	int8_t sy = (y1 > y0) ? 1 : -1;
+	int err = dx + dy;
+	for (;;) {
+		putPixel(x0, y0, color);
+		if ((x0 == x1) && (y0 == y1)) break;
+		int e2 = 2 * err;
+		if (e2 >= dy) { err += dy; x0 += sx; }
+		if (e2 <= dx) { err += dx; y0 += sy; }
+	}
+}
+
+void APLcanvas::fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
+	if (y >= getHeight()) return;
+	uint8_t end = (h > getHeight() - y) ? getHeight() : y + h;
+	for (; y < end; y++) hLine(x, y, w, color);
+}
+
+void APLcanvas::blit(uint8_t x, uint8_t y, const uint8_t* image) {
+	for (uint8_t row = 0; row < TileMemHeight; row++) {
+		if ((unsigned int)y + row >= getHeight()) break;
+		const uint8_t* pSrc = image + row * TileMemWidth;
+		if (((x & (TilePixWidth-1)) == 0) && (x < getWidth())) {
+			// aligned on a tile, the row is copied
+			uint8_t* p = pixelByte(x, y + row);
+			for (uint8_t i = 0; i < TileMemWidth; i++) p[i] = pgm_read_byte(pSrc + i);
+		}
+		else {
+			for (uint8_t col = 0; col < TilePixWidth; col++) {
+				if ((unsigned int)x + col >= getWidth()) break;
+				putPixel(x + col, y + row, (pgm_read_byte(pSrc + col / TilePixPerByte) >> tilePixShift(col)) & TilePixMask);
+			}
+		}
+	}
+}
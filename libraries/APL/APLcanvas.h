@@ -0,0 +1,62 @@
+/***************************************************************************************************/
+/*                                                                                                 */
+/* file:          APLcanvas.h                                                                      */
+/*                                                                                                 */
+/* source:        2018-2025, written by Adrian Kundert (adrian.kundert@gmail.com)                  */
+/*                                                                                                 */
+/* description:   APL bitmap canvas drawn into a pool of RAM tiles                                 */
+/*                                                                                                 */
+/* This library is free software; you can redistribute it and/or modify it under the terms of the  */
+/* GNU Lesser General Public License as published by the Free Software Foundation;                 */
+/* either version 2.1 of the License, or (at your option) any later version.                       */
+/*                                                                                                 */
+/* This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;       */
+/* without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.       */
+/* See the GNU Lesser General Public License for more details.                                     */
+/*                                                                                                 */
+/***************************************************************************************************/
+
+#ifndef APLcanvas_h
+#define APLcanvas_h
+
+#include "APLcore.h"
+
+// The canvas maps w by h screen tiles from the tile position (x,y) onto a RAM pool of w*h tiles (canvasPoolSize() bytes,
+// row by row), the pixels are drawn directly into the pool tiles shown by show().
+// The pixel values are R,G,B from the MSB with PIXEL_HW_MUX (2 pixels per byte), 0 to 3 without (4 pixels per byte).
+// With SCREEN_INDEX_MAP, the pool must be the RAM tileset (see setTileset()).
+inline unsigned int canvasPoolSize(uint8_t w, uint8_t h) {
+	return (unsigned int)w * h * TileMemSize;
+}
+
+class APLcanvas
+{
+	public:
+		APLcanvas(APLcore* pAPL, uint8_t* pool, uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+		void show();													///< set the pool tiles on the screen, GraphMode
+		void clear(uint8_t color);										///< fill the whole canvas
+		void putPixel(uint8_t x, uint8_t y, uint8_t color);				///< the pixels out of the canvas are ignored (also for the functions below)
+		uint8_t getPixel(uint8_t x, uint8_t y);
+		void hLine(uint8_t x, uint8_t y, uint8_t w, uint8_t color);		///< horizontal span of w pixels from (x,y)
+		void vLine(uint8_t x, uint8_t y, uint8_t h, uint8_t color);		///< vertical span of h pixels from (x,y)
+		void line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t color);	///< Bresenham line from (x0,y0) to (x1,y1) included
+		void fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color);
+		void blit(uint8_t x, uint8_t y, const uint8_t* image);			///< draw the PGM image of a GraphMode tile (TileMemSize bytes) at the pixel position (x,y)
+		uint8_t getWidth() {
+			return tileW * TilePixWidth;
+		}
+		uint8_t getHeight() {
+			return tileH * TileMemHeight;
+		}
+	private:
+		uint8_t fillByte(uint8_t color);
+		uint8_t* pixelByte(uint8_t x, uint8_t y);
+	private:
+		APLcore* pAPL;
+		uint8_t* pool;
+		uint8_t tileX, tileY;		// screen tile position
+		uint8_t tileW, tileH;		// size in tiles
+		unsigned int rowSize;		// pool bytes of a tile row
+};
+
+#endif
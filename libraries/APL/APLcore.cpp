@@ -27,29 +27,232 @@
 #pragma GCC optimize ("-O3") // speed optimization
 
 //================================ ISR variables (begin) ==========================================//
+// the blitter line must fit in the H-sync period (widths and unroll counts from APLcore.h)
+#if (VIEW_TILES_TEXT < 2) || (VIEW_TILES_GRAPH < 2)
+	#error "F_CPU too low for the blitter (2 tiles per line at least)"
+#endif
+#if BLIT_RESIDUE_TEXT + BLIT_OVERHEAD_LINE + VIEW_TILES_TEXT * BLIT_CYCLES_TEXT > LINE_CYCLES
+	#error "the TextMode line does not fit in the H-sync period"
+#endif
+#if BLIT_RESIDUE_GRAPH + BLIT_OVERHEAD_LINE - BLIT_SAVED_GRAPH + VIEW_TILES_GRAPH * BLIT_CYCLES_GRAPH > LINE_CYCLES
+	#error "the GraphMode line does not fit in the H-sync period"
+#endif
+#ifndef PIXEL_HW_MUX
+#if BLIT_RESIDUE_GRAPH_PGM + BLIT_OVERHEAD_LINE + VIEW_TILES_GRAPH_PGM * BLIT_CYCLES_GRAPH > LINE_CYCLES
+	#error "the GraphPgmMode line does not fit in the H-sync period"
+#endif
+#if 2 * VIEW_TILES_GRAPH > 63
+	#error "F_CPU too high for the blitter (adiw offset to the line end)"
+#endif
+#endif
+// the conservative overheads of the other clocks must not give more tiles than the measures
+#ifdef MEASURED_TILES_TEXT
+#if (BLIT_TILES(BLIT_OVERHEAD_TEXT, BLIT_CYCLES_TEXT) > MEASURED_TILES_TEXT) || (BLIT_TILES(BLIT_OVERHEAD_GRAPH, BLIT_CYCLES_GRAPH) > MEASURED_TILES_GRAPH)
+	#error "BLIT_OVERHEAD_TEXT or BLIT_OVERHEAD_GRAPH below a measured residue"
+#endif
+#if !defined(PIXEL_HW_MUX) && (BLIT_TILES(BLIT_OVERHEAD_GRAPH_PGM, BLIT_CYCLES_GRAPH) > MEASURED_TILES_GRAPH_PGM)
+	#error "BLIT_OVERHEAD_GRAPH_PGM below a measured residue"
+#endif
+#endif
 // screen and buffer allocations
-const int srcBufSize = (int)scrBufWidthInTile * (int)(scrBufHeightInTile); // one tile row more required for y scrolling in graph mode
-volatile uint8_t* scrBuf[srcBufSize];	// non-atomic shared variable
-const uint8_t NONE=0, UPDATE=1, S_LEFT=2, S_RIGHT=3, S_UP=4, S_DOWN=5;
-volatile uint8_t TileNext = NONE;		// semaphore for scrBuf[] update
-volatile uint8_t* TilePtrNext;			
-volatile unsigned int newTileIndexNext;
+const int srcBufSize = (int)scrBufWidthInTile * (int)(scrBufHeightInTileMax); // one tile row more required for y scrolling in graph mode
+#ifdef SCREEN_240_LINES
+#ifndef SCREEN_INDEX_MAP
+	#error "SCREEN_240_LINES requires SCREEN_INDEX_MAP (31 rows of tile pointers do not fit in RAM)"
+#endif
+#ifdef SCREEN_DOUBLE_BUFFER
+	#error "SCREEN_240_LINES and SCREEN_DOUBLE_BUFFER do not fit together in RAM"
+#endif
+// set by initScreenBuffer(mode, scaling)
+volatile uint8_t lineScaling = verticalScaling;
+volatile uint8_t scrViewHeight = scrViewHeightInTile;
+volatile uint8_t scrBufHeight = scrBufHeightInTile;
+const uint8_t verticalScalingMin = verticalScaling240;
+#else
+const uint8_t lineScaling = verticalScaling;
+const uint8_t scrViewHeight = scrViewHeightInTile;
+const uint8_t scrBufHeight = scrBufHeightInTile;
+const uint8_t verticalScalingMin = verticalScaling;
+#endif
+#ifdef SCREEN_INDEX_MAP
+typedef uint8_t ScreenCell;				// tile index resolved by the tileset
+#else
+typedef volatile uint8_t* ScreenCell;	// tile pointer (PGM_MARKER for PGM tiles)
+#endif
+#ifdef SCREEN_DOUBLE_BUFFER
+#ifndef SCREEN_INDEX_MAP
+	#error "SCREEN_DOUBLE_BUFFER requires SCREEN_INDEX_MAP (two tile pointer buffers do not fit in RAM)"
+#endif
+ScreenCell scrPage[2][srcBufSize];
+ScreenCell* scrBuf = scrPage[0];		// displayed page
+ScreenCell* scrBack = scrPage[1];		// page composed by the main loop, swapped at frame begin
+volatile uint8_t presentPending = 0;	// set by present(), cleared by the ISR after the swap
+#else
+ScreenCell scrBuf[srcBufSize];	// non-atomic shared variable
+#endif
 const unsigned int PGM_MARKER = 0x8000;
+#ifdef SCREEN_INDEX_MAP
+// tile index resolution, the ISR latches the tileset at frame begin
+struct Tileset {
+	uint8_t* pgm;						// PGM tileset (PGM_MARKER included) for the indexes below ramFirst
+	uint8_t* ram;						// RAM tileset for the indexes from ramFirst
+	uint8_t ramFirst;
+	uint8_t size;						// tile size in bytes
+	uint8_t* pgmOdd;					// PGM tileset of the odd frames (temporal dithering), NULL for none
+	uint8_t* ramOdd;					// RAM tileset of the odd frames
+};
+volatile uint8_t tilesetMutex = 0;		// mutex for tilesetNext
+volatile Tileset tilesetNext;			// non-atomic shared variable
+Tileset tileset;
+uint8_t* framePgm;						// tileset.pgm or tileset.pgmOdd rendered by the frame
+uint8_t* frameRam;
+uint8_t oddFrame = 0;
+// the blitter renders the tile pointers of the current row while the ISR expands the next row (BLIT_LINE_INDEX_MAP charges the same count)
+const uint8_t TileExpandPerLine = (scrBufWidthInTile + verticalScalingMin*TileMemHeight - 2) / (verticalScalingMin*TileMemHeight - 1);
+volatile uint8_t* scrRowBuf[3][scrBufWidthInTile];	// the third row buffer holds the split row
+uint8_t scrRowFront = 0;				// row buffer rendered
+uint8_t scrRowBack = 1;					// row buffer expanded
+uint8_t expandRow = 0;					// scrBuf[] row expanded into the back row buffer
+uint8_t expandCol = scrBufWidthInTile;	// next column to expand, the row is completed at scrBufWidthInTile
+#endif
+
+#ifdef SCANLINE_RENDER
+#ifdef SCREEN_INDEX_MAP
+	#error "SCANLINE_RENDER requires the tile pointer screen buffer (no SCREEN_INDEX_MAP)"
+#endif
+// tiles of the first build slice, balanced with the second one (the other tiles and a sprite span)
+#define SCANLINE_SLICE_TILES ((SCANLINE_SPAN - SCANLINE_SELECT + (VIEW_TILES_GRAPH + 1) * SCANLINE_TILE + 2 * SCANLINE_TILE - 1) / (2 * SCANLINE_TILE))
+#if (VIEW_TILES_GRAPH >= 2) && (SCANLINE_SLICE_TILES > VIEW_TILES_GRAPH + 1)
+	#error "the first scanline build slice has more tiles than the line"
+#elif (VIEW_TILES_GRAPH >= 2) && ((SCANLINE_SLICE + SCANLINE_SELECT + SCANLINE_SLICE_TILES * SCANLINE_TILE > BLIT_LINE_SCANLINE) || (SCANLINE_SLICE + (VIEW_TILES_GRAPH + 1 - SCANLINE_SLICE_TILES) * SCANLINE_TILE + SCANLINE_SPAN > BLIT_LINE_SCANLINE) || (SCANLINE_SLICE + SCANLINE_SPAN > BLIT_LINE_SCANLINE))
+	#error "a scanline build slice does not fit in the cycles reserved on the GraphMode lines"
+#endif
+// the first pixel line is built over the last two back porch lines, the first one latches the frame and its sprites
+#define SCANLINE_LATCH 120		// latchScrolling() and the sprite latch, or the cursor blink of the frame begin line
+#if (VIEW_TILES_GRAPH >= 2) && (SCANLINE_LATCH + BLIT_LINE_SCANLINE > LINE_CYCLES - BLIT_RESIDUE_TEXT - BLIT_LINE_PROFILE)
+	#error "the first scanline build slices do not fit in the back porch lines"
+#endif
+// GraphMode pixel lines are built into a RAM line buffer, rendered as a row of single line RAM tiles
+const uint8_t LineTiles = scrViewWidthInTileGRAPH + 1;	// one tile more for the x scrolling
+const uint8_t LineSliceTiles = SCANLINE_SLICE_TILES;
+const uint8_t LineSpriteMax = 4;		// sprites set by setLineSprite()
+const uint8_t LineSpanMax = 2;			// sprite spans drawn per line (one per slice), the first sprites on the line
+const uint8_t LineSpanNone = 0xff;
+struct LineSprite {
+	const uint8_t* image;				// PGM tile of GraphMode, NULL when hidden
+	uint8_t x, y;						// pixel position in the line buffer and the screen buffer rows
+};
+volatile uint8_t lineSpriteMutex = 0;	// mutex for lineSpriteNext
+volatile LineSprite lineSpriteNext[LineSpriteMax];	// non-atomic shared variable
+LineSprite lineSprite[LineSpriteMax];	// latched at frame begin
+uint8_t lineBuf[2][LineTiles * TileMemWidth];
+volatile uint8_t* lineTile[2][LineTiles];	// RAM tile pointers to the line buffer
+uint8_t lineFront = 0;					// line buffer rendered
+uint8_t lineBuilt = 0;					// the front line buffer holds the pixel line, else rendered from its tiles without sprites
+uint8_t lineBuildStep = 0;				// slices of the back line buffer built, 3 when complete
+uint8_t lineBuildLine;					// screen buffer pixel line built
+ScreenCell* pLineBuildRow;				// its first tile
+uint8_t lineBuildOffset;				// its line offset in the tiles
+uint8_t lineSpan[LineSpanMax];			// its sprites, LineSpanNone when unused
+#endif
 
-// VGA rendering variables
-const uint8_t verticalBackPorchLines = 35;  // includes 2 sync pulses  
-const unsigned int activeLines = 480;  // 480 pixels high
-const uint8_t verticalFrontPorchLines = 10;  
-const unsigned int totalLines = verticalBackPorchLines + activeLines + verticalFrontPorchLines;  // 525 lines totally
+// tile command queue for scrBuf[] update (lock-free: the main loop writes the head, the ISR the tail)
+const uint8_t NONE=0, UPDATE=1, S_LEFT=2, S_RIGHT=3, S_UP=4, S_DOWN=5, FILL=6, BLIT=7, COPY=8;
+struct TileCmd {
+	uint8_t cmd;
+	uint8_t w, h;						// tile columns and rows left to process (FILL, BLIT, COPY, S_xxx)
+	uint8_t arg;						// tile cell increment (BLIT) or backward copy (COPY)
+	uint8_t skip;						// source tiles skipped at the row end (BLIT)
+	unsigned int index;					// scrBuf[] index of the first tile
+	ScreenCell cell;					// tile or first tile of the tileset (BLIT)
+	unsigned int src;					// index map address (BLIT) or scrBuf[] source index (COPY)
+};
+#ifndef SCREEN_DOUBLE_BUFFER
+// blanking line cycles left to the queue: the line without the measured residue of an active line (its ISR entry, bookkeeping,
+// PS2 and UART, the blitter setup is not done on a blanking line); a command row costs TILE_QUEUE_CMD cycles (volatile entry,
+// switch, index and ring bookkeeping) and TILE_QUEUE_TILE cycles per tile written (instruction count estimates)
+#define TILE_QUEUE_CYCLES (LINE_CYCLES - BLIT_RESIDUE_TEXT - BLIT_LINE_PROFILE)
+#define TILE_QUEUE_CMD 60
+#define TILE_QUEUE_TILE 12
+#if TILE_QUEUE_CMD + VIEW_TILES_TEXT * TILE_QUEUE_TILE > TILE_QUEUE_CYCLES
+	#error "a tile command row (scrBufWidthInTile tiles) does not fit in a blanking line"
+#endif
+const uint8_t TileQueueSize = 16;		// 2^n base required
+const unsigned int TileQueueBudget = TILE_QUEUE_CYCLES;	// cycles per blanking line
+const uint8_t TileQueueRowMax = 4;		// command rows per blanking line
+volatile TileCmd TileQueue[TileQueueSize];
+volatile uint8_t TileQueueHead = 0;		// next free entry, written by the main loop only
+volatile uint8_t TileQueueTail = 0;		// next entry to process, written by the ISR only
+#endif
+
+// VGA rendering variables (VGA_TIMING profile)
+const unsigned int activeLines = (unsigned int)scrViewHeightInTile * TileMemHeight * verticalScaling;  // 480 pixels high at most
+const uint8_t verticalBackPorchLines = VGA_VSYNC_LINES + VGA_VBACK_LINES + (VGA_ACTIVE_LINES - activeLines) / 2;  // includes the sync pulses and the upper black lines
+const uint8_t verticalFrontPorchLines = VGA_VFRONT_LINES + (VGA_ACTIVE_LINES - activeLines) - (VGA_ACTIVE_LINES - activeLines) / 2;
+const unsigned int totalLines = verticalBackPorchLines + activeLines + verticalFrontPorchLines;  // 525 lines totally at 640x480
+const uint8_t vsyncPulse = (VGA_SYNC_POSITIVE & 2) ? 0x04 : 0;	// PORTB VSYNC level during the pulse
 volatile uint8_t cursorMutex = 0;				// mutex for cursorTileIndex
 volatile unsigned int cursorTileIndex = 0xffff;	// non-atomic shared variable
-volatile uint8_t* cursorOnTile = NULL;
-volatile uint8_t* cursorOffTile = NULL;
-volatile uint8_t xScroll = 0, yScroll = 0; // x scrolling, value between 0 and 6, y between 0 and 7
-volatile uint8_t TileScroll = 0;
+ScreenCell cursorOnTile;
+ScreenCell cursorOffTile;
+volatile uint8_t xScroll = 0, yScroll = 0; // x scrolling, value between 0 and 7 (odd on alternate frames), y between 0 and TileMemHeight-1
+volatile uint8_t TileScroll = 0;		// coarse vertical scroll origin in pixel lines (buffer row * TileMemHeight)
+volatile uint8_t scrollMutex = 0;		// mutex for yScroll and TileScroll updated together
+uint8_t scrollLine = 0;					// yScroll + TileScroll latched at frame begin
+volatile uint8_t TileColScroll = 0;		// coarse horizontal scroll origin in tiles
+volatile uint8_t TileColOffset = 0;		// TileColScroll latched at frame begin
+volatile uint8_t xScrollOffset = 0;		// xScroll latched at frame begin
+uint8_t xScrollPhase = 0;				// an odd x scrolling is rendered 1 px left on even frames and 1 px right on odd frames
+volatile uint8_t colorMask = 0;			// DDRD color pins of the screen color
+uint8_t lineHidden = 0;					// screen pixel line rendered black
+#ifdef RASTER_EFFECTS
+volatile uint8_t rowScroll[scrViewHeightInTileMax];	// per screen tile row: tile column << 3 | x scrolling, 0xff for the global scrolling
+volatile uint8_t rowColor[scrViewHeightInTileMax];	// per screen tile row: DDRD color pins, 0 for the screen color
+volatile uint8_t TileSplit = 0;			// screen pixel line of the split (rendered from the same buffer row without scrolling), 0 when none
+uint8_t splitLine = 0;					// TileSplit latched at frame begin
+uint8_t viewLine = 0;					// screen pixel line
+#endif
+volatile uint8_t activeMutex = 0;		// mutex for activeLineFirst and activeLineEnd
+volatile uint8_t activeLineFirst = 0;	// first rendered screen pixel line
+volatile uint8_t activeLineEnd = scrViewHeightInTile * TileMemHeight;	// screen pixel line after the rendered ones
+uint8_t viewFirst = 0;					// activeLineFirst latched at frame begin
+uint8_t viewEnd = scrViewHeightInTile * TileMemHeight;	// activeLineEnd latched at frame begin
+volatile unsigned int vLineActive = activeLines;	// active zone line of the ISR
+#ifndef RASTER_EFFECTS
+unsigned int lineEvent = activeLines - 1;	// vLineActive of the line before the active rows begin or end, or the active zone ends
+#endif
+#ifdef ISR_PROFILE
+unsigned long isrTicks[2] = {0, 0};		// timer1 ticks (8 cycles) spent in the ISR during the frame, per phase
+volatile unsigned long phaseCycles[2] = {0, 0};	// ISR cycles per phase during the last frame
+volatile unsigned long mainCycles = 0;	// cycles left to the main loop during the last frame
+#endif
+uint8_t linePhase = PhaseBlank;			// phase of the next line, set at frame begin and by the pixel line changes
+#if defined(RASTER_EFFECTS) && !defined(SCREEN_INDEX_MAP)
+volatile uint8_t lineMapMutex = 0;		// mutex for lineMapNext
+uint8_t* volatile lineMapNext = NULL;	// non-atomic shared variable
+uint8_t* lineMap = NULL;				// lineMapNext latched at frame begin
+uint8_t originLine = 0;					// scroll origin latched at frame begin
+#endif
 volatile uint8_t VGAmode;
 volatile uint8_t MemWidth;
+#ifdef RASTER_EFFECTS
+volatile uint8_t rowMode[scrViewHeightInTileMax];	// per screen tile row: VGA mode, Disabled for the screen mode
+#endif
+volatile uint8_t lineVGAmode = Disabled;	// VGA mode rendered (the screen tile row mode)
+volatile uint8_t lineMemWidth;			// memory width of lineVGAmode
 volatile uint8_t pixLine = 0;
+volatile uint8_t scalingCnt = 0;		// screen line of the pixel line, reset at frame begin
+
+#ifdef RASTER_EFFECTS
+// raster line callback
+volatile uint8_t rasterMutex = 0;		// mutex for rasterCallback, rasterLine and rasterEvery
+volatile RasterCallback rasterCallback = NULL;	// non-atomic shared variable
+volatile uint8_t rasterLine = 0;
+volatile uint8_t rasterEvery = 0;
+uint8_t rasterNext = 0;					// next screen pixel line called back
+volatile unsigned int rasterCycles = 0;	// longest callback measured
+volatile uint8_t rasterOverrun = 0;		// callbacks over RasterCallbackBudget
+#endif
 
 // Audio variable
 volatile uint8_t soundMutex = 0;			// mutex for soundbufptr and BASIC_duration
@@ -71,8 +274,24 @@ volatile unsigned char dateY, dateM, dateD, timeH, timeM, timeS, tick;
 #ifdef PIXEL_HW_MUX
 inline void VGArendering() {
 	// the tile line is repeated HeightScaling
-	register unsigned int TileIndex = (pixLine / TileMemHeight) * (unsigned int)scrBufWidthInTile;
-	register uint8_t TilePixOffset = (pixLine & (TileMemHeight-1)) * MemWidth;
+#ifdef SCREEN_INDEX_MAP
+	register volatile uint8_t** pTileRow = &scrRowBuf[scrRowFront][TileColOffset];
+#else
+	register volatile uint8_t** pTileRow = &scrBuf[(pixLine / TileMemHeight) * (unsigned int)scrBufWidthInTile + TileColOffset];
+#endif
+#ifdef TILE_HEIGHT_16
+	register uint8_t tileLine = pixLine & (TileMemHeight-1);
+	if (lineVGAmode == TextMode) tileLine >>= 1;	// the 8 px font lines are doubled
+	register uint8_t TilePixOffset = tileLine * lineMemWidth;
+#else
+	register uint8_t TilePixOffset = (pixLine & (TileMemHeight-1)) * lineMemWidth;
+#endif
+#ifdef SCANLINE_RENDER
+	if (lineBuilt && (lineVGAmode == GraphMode)) {
+		pTileRow = &lineTile[lineFront][0];	// pixel line built by the ISR
+		TilePixOffset = 0;
+	}
+#endif
 
 	// blit pixel data to screen in HW mux (8 clock / 2 pix)
 	asm volatile (
@@ -90,26 +309,16 @@ inline void VGArendering() {
 		"TEXT_MODE: \n\t"
 		"cpi r16, 1 \n\t" "breq TEXT_MODE_1 \n\t" "rjmp PGM_RAM_end8 \n\t" // exit when mode disabled
 		"TEXT_MODE_1: \n\t"
-		#if F_CPU == 32000000UL
-		".rept 15  \n\t" // porch delay
+		".rept %[porch]  \n\t" // porch delay
 			"nop     \n\t"
 		".endr     \n\t"
-		#endif
 	
 		"sbi 0x05, 0 \n\t"                            // 2      the SBI enables the pixelMux, critical timing set just before the out instruction or 8*n cycles earlier
 		"ld ZL, X+ \n\t" "ld ZH, X+ \n\t"             // 2+2    load the value end of the line
 		"nop \n\t"                                    // 1
 		"add ZL, r15  \n\t" "adc ZH, r1 \n\t"         // 1+1
 	
-		#if F_CPU == 32000000UL
-		".rept 29 \n\t"
-		#elif F_CPU == 24000000UL
-		".rept 20 \n\t"
-		#elif F_CPU == 20000000UL
-		".rept ?? \n\t"
-		#else // Arduino default 16 MHz
-		".rept 9 \n\t"
-		#endif
+		".rept %[textTiles] \n\t"
 										  "lpm r0, Z+ \n\t"                          "nop \n\t"       "nop \n\t"         // 3+1+1
 			"out 0x0b, r0 \n\t" "lpm r0, Z+ \n\t" "ld YL, X+ \n\t"                   "ld YH, X+ \n\t"                    // 1+3+2+2
 			"out 0x0b, r0 \n\t" "lpm r0, Z+ \n\t" "nop \n\t"     "add YL, r15  \n\t" "adc YH,r1\n\t"  "movw Z,Y \n\t"    // 1+3+1+1+1+1
@@ -150,15 +359,7 @@ inline void VGArendering() {
 		"brmi .+2 \n\t" "rjmp .+44 \n\t"																 					// 1(2)+2
 	
 		//------------------------------ render the Tiles after the x scrolling -----------------------------------------------------//
-		#if F_CPU == 32000000UL
-		".rept 21-1 \n\t" // tile below and scrolled tile subtracted
-		#elif F_CPU == 24000000UL
-		".rept 14-1 \n\t" // tile below and scrolled tile subtracted
-		#elif F_CPU == 20000000UL
-		".rept ?? \n\t" // tile below and scrolled tile subtracted
-		#else   // Arduino default 16 MHz
-		".rept 6-1 \n\t"
-		#endif
+		".rept %[graphTiles]-1 \n\t" // tile below and scrolled tile subtracted
 			//"PGM_n: \n\t" // (code size 22 words)
 												"lpm r0, Z+ \n\t"				  "nop \n\t"           "nop \n\t"        //     3+1+1
 			"out 0x0b, r0 \n\t" "lpm r0, Z+ \n\t" "ld YL, X+ \n\t"                "nop \n\t"           "nop \n\t"        // 1+3+2+1+1
@@ -202,7 +403,8 @@ inline void VGArendering() {
 		// restore unsaved registers
 		"pop r17 \n\t" "pop r16 \n\t" "pop r15 \n\t" "pop r1 \n\t" "pop r0 \n\t"
 		:
-		:  "x" (&scrBuf[TileIndex]), "r" (TilePixOffset), "r" (VGAmode), "r" (xScroll)
+		:  "x" (pTileRow), "r" (TilePixOffset), "r" (lineVGAmode), "r" (xScrollOffset),
+		   [porch] "i" (PORCH_DELAY), [textTiles] "i" (scrViewWidthInTileTEXT), [graphTiles] "i" (scrViewWidthInTileGRAPH)
 		// gcc assignation        x,                 r15,           r16,          r17,	    // ensure the assigned register by the compiler are not overwritten by the user code
 		: "r31", "r30", "r29", "r28"														// specify to the compiler the used registers not explicitly taken as parameter
 	);
@@ -210,8 +412,24 @@ inline void VGArendering() {
 #else
 inline void VGArendering() {
 	// the tile line is repeated HeightScaling
-	register unsigned int TileIndex = (pixLine / TileMemHeight) * (unsigned int)scrBufWidthInTile;
-	register uint8_t TilePixOffset = (pixLine & (TileMemHeight-1)) * MemWidth;
+#ifdef SCREEN_INDEX_MAP
+	register volatile uint8_t** pTileRow = &scrRowBuf[scrRowFront][TileColOffset];
+#else
+	register volatile uint8_t** pTileRow = &scrBuf[(pixLine / TileMemHeight) * (unsigned int)scrBufWidthInTile + TileColOffset];
+#endif
+#ifdef TILE_HEIGHT_16
+	register uint8_t tileLine = pixLine & (TileMemHeight-1);
+	if (lineVGAmode == TextMode) tileLine >>= 1;	// the 8 px font lines are doubled
+	register uint8_t TilePixOffset = tileLine * lineMemWidth;
+#else
+	register uint8_t TilePixOffset = (pixLine & (TileMemHeight-1)) * lineMemWidth;
+#endif
+#ifdef SCANLINE_RENDER
+	if (lineBuilt && (lineVGAmode == GraphMode)) {
+		pTileRow = &lineTile[lineFront][0];	// pixel line built by the ISR
+		TilePixOffset = 0;
+	}
+#endif
 
 	// blit pixel data to screen without pixel HW mux (4 clock / pix)
 	asm volatile (
@@ -229,20 +447,16 @@ inline void VGArendering() {
 		"ldi r16, 4 \n\t" "mov r2, r16 \n\t" "clr r16 \n\t"
 		
 		// xscrolling calculation
-		//#ifdef NO_XSCROLLING
-		//"clr r17 \n\t" "rjmp BEGIN \n\t" // add this line to remove the xscrolling and increase the tile resolution
-		//#endif
+		#ifdef NO_XSCROLLING
+		"clr r17 \n\t"		// no scrolled part tile, the saved cycles give the extra tile column
+		".rept %[porch]  \n\t" // porch delay
+			"nop     \n\t"
+		".endr     \n\t"
+		"rjmp BEGIN \n\t"
+		#endif
 		"movw Y,X \n\t"		// do a copy
 		
-		#if F_CPU == 32000000UL
-			"adiw Y,34 \n\t"	// move to the end + (2*scrViewWidthInTileGRAPH)
-		#elif F_CPU == 24000000UL
-			"adiw Y,22 \n\t"	// move to the end + (2*scrViewWidthInTileGRAPH)
-		#elif F_CPU == 20000000UL
-			"adiw Y,?? \n\t"	// move to the end + (2*scrViewWidthInTileGRAPH)
-		#else   // Arduino default 16 MHz
-			"adiw Y,8 \n\t"	// move to the end + (2*scrViewWidthInTileGRAPH)
-		#endif		
+		"adiw Y,%[graphEnd] \n\t"	// move to the end + (2*scrViewWidthInTileGRAPH)
 		"ld ZL, Y+ \n\t" "ld ZH, Y+ \n\t" "add ZL, r15 \n\t" "adc ZH, r16 \n\t"
 		"tst ZH \n\t"
 		"brmi PGM6 \n\t" "nop \n\t"														//1(2)+1
@@ -294,15 +508,7 @@ inline void VGArendering() {
 					 "brmi .+12 \n\t" "rjmp .+62 \n\t"				 					// 1(2)+2
 
 		// max value allowed is scrBufWidthInTile
-		#if F_CPU == 32000000UL
-		".rept 17-1 \n\t"
-		#elif F_CPU == 24000000UL
-		".rept 11-1 \n\t"
-		#elif F_CPU == 20000000UL
-		".rept ?? \n\t"
-		#else   // Arduino default 16 MHz
-		".rept 4-1 \n\t"
-		#endif
+		".rept %[graphTiles]-1 \n\t"
 		
 			//--------------------- PGM source (code size 29 words) -------------------------
 			//"PGM_1: \n\t"
@@ -355,11 +561,9 @@ inline void VGArendering() {
 		
 		"NEXT_MODE: \n\t"		
 		"cpi r16, 0 \n\t" "breq PGM_RAM_end \n\t" // exit when mode disabled
-		#if F_CPU == 32000000UL
-		".rept 15  \n\t" // porch delay for GRAPH_PGM and TEXT
+		".rept %[porch]  \n\t" // porch delay for GRAPH_PGM and TEXT
 			"nop     \n\t"
 		".endr     \n\t"
-		#endif
 		"cpi r16, 2 \n\t" "breq GRAPH_PGM_MODE \n\t" "rjmp NEXT_MODE2 \n\t"
 		
 		//-- 4clk/pix (RGB 8 colors )---------------------------- GRAPH_PGM MODE: render the Tiles WITHOUT x scrolling -----------------------------------------------------//
@@ -368,15 +572,7 @@ inline void VGArendering() {
 		"ld ZL, X+ \n\t" "ld ZH, X+ \n\t" "add ZL, r15  \n\t" "adc ZH, r16 \n\t"
 		
 		// max value allowed is scrBufWidthInTile
-		#if F_CPU == 32000000UL
-		".rept 19 \n\t"
-		#elif F_CPU == 24000000UL
-		".rept 13 \n\t"
-		#elif F_CPU == 20000000UL
-		".rept ?? \n\t"
-		#else   // Arduino default 16 MHz
-		".rept 6 \n\t"
-		#endif
+		".rept %[pgmTiles] \n\t"
 								"lpm r0, Z+ \n\t"                   					//      3
 			"out 0x0b, r0 \n\t" "mul r0,r2 \n\t"  "ld YL, X+ \n\t" 						// out1 1+1+2
 			"out 0x0b, r0 \n\t" "lpm r0, Z+ \n\t"       								// out2 1+3
@@ -398,15 +594,7 @@ inline void VGArendering() {
 		"ld ZL, X+ \n\t" "ld ZH, X+ \n\t" "add ZL, r15 \n\t" "adc ZH, r1 \n\t"
 		
 		// max value allowed is scrBufWidthInTile
-		#if F_CPU == 32000000UL
-		"ldi r16, 29 \n\t"
-		#elif F_CPU == 24000000UL
-		"ldi r16, 19 \n\t"
-		#elif F_CPU == 20000000UL
-		"ldi r16, ?? \n\t"
-		#else   // Arduino default 16 MHz
-		"ldi r16, 8 \n\t"
-		#endif
+		"ldi r16, %[textTiles] \n\t"
 		"rjmp TEXT_entry \n\t"	
 		
 		"TEXT_1: \n\t"												"lsl r0 \n\t"		//		  1
@@ -426,13 +614,435 @@ inline void VGArendering() {
 		// restore unsaved registers
 		"pop r17 \n\t" "pop r16 \n\t" "pop r15 \n\t" "pop r2 \n\t" "pop r1 \n\t" "pop r0 \n\t"
 		:
-		:  "x" (&scrBuf[TileIndex]), "r" (TilePixOffset), "r" (VGAmode), "r" (xScroll)
+		:  "x" (pTileRow), "r" (TilePixOffset), "r" (lineVGAmode), "r" (xScrollOffset),
+		   [porch] "i" (PORCH_DELAY), [textTiles] "i" (scrViewWidthInTileTEXT), [graphTiles] "i" (scrViewWidthInTileGRAPH),
+		   [pgmTiles] "i" (scrViewWidthInTileGRAPH_PGM), [graphEnd] "i" (2*scrViewWidthInTileGRAPH)
 		// gcc assignation        x,                 r15,           r16,          r17,	    // ensure the assigned registers by the compiler are not overwritten by the user code
 		: "r31", "r30", "r29", "r28", "r1", "r0"												// specify to the compiler the used registers not explicitly taken as parameter
 	);
 }
 #endif
 
+// VGA mode of the screen tile row
+inline uint8_t rowVGAmode(uint8_t viewRow) {
+#ifdef RASTER_EFFECTS
+	uint8_t mode = rowMode[viewRow];
+	if ((mode == Disabled) || (VGAmode == Disabled)) mode = VGAmode;
+	return mode;
+#else
+	(void)viewRow;
+	return VGAmode;
+#endif
+}
+
+inline void applyRowMode(uint8_t viewRow) {
+	uint8_t mode = rowVGAmode(viewRow);
+	uint8_t width = MemWidth;
+	if (mode != VGAmode) {
+		if (mode == TextMode) width = FontMemWidth;
+		else width = TileMemWidth;
+#ifndef PIXEL_HW_MUX
+		if (mode == GraphPgmMode) width = TileMemWidth4B;
+#endif
+	}
+	lineVGAmode = mode;
+	lineMemWidth = width;
+}
+
+// horizontal scrolling of the screen tile row: tile column << 3 | x scrolling
+inline uint8_t rowHScroll(uint8_t viewRow) {
+#ifdef RASTER_EFFECTS
+	uint8_t value = rowScroll[viewRow];
+	if (value == 0xff) value = (TileColScroll << 3) | xScroll;
+#else
+	(void)viewRow;
+	uint8_t value = (TileColScroll << 3) | xScroll;
+#endif
+	if (value & 1) value = value - 1 + (xScrollPhase << 1);	// the blitter scrolls by 2 px, carried to the next tile column at 8
+	return value;
+}
+
+inline void applyRowScroll(uint8_t viewRow) {
+	uint8_t value = (lineVGAmode == TextMode) ? 0 : rowHScroll(viewRow);	// the text rows use all the columns
+	xScrollOffset = value & 0b110;
+	TileColOffset = value >> 3;
+}
+
+#ifdef RASTER_EFFECTS
+// color pins of the screen tile row, set during the horizontal blank
+inline void applyRowColor(uint8_t viewRow) {
+	uint8_t mask = rowColor[viewRow];
+	if (mask == 0) mask = colorMask;
+	DDRD = (DDRD & 0b00000011) | mask;	// RX & TX unchanged
+}
+
+// raster callback for the screen pixel line to come, timed with timer1 (F_CPU/8)
+inline void rasterCall() {
+	if ((viewLine != rasterNext) || (rasterMutex != 0) || (rasterCallback == NULL)) return;
+	unsigned int start = TCNT1;
+	rasterCallback(viewLine);
+	unsigned int end = TCNT1;
+	unsigned int cycles = (end >= start) ? (end - start) * 8 : 0xffff;	// 0xffff when the next line began
+	if (cycles > rasterCycles) rasterCycles = cycles;
+	if ((cycles > RasterCallbackBudget) && (rasterOverrun != 0xff)) rasterOverrun++;
+	rasterNext = (rasterEvery != 0) ? viewLine + rasterEvery : 0xff;
+}
+
+#ifndef SCREEN_INDEX_MAP
+// source pixel line of the screen pixel line from the line map
+inline uint8_t mapLine(uint8_t line) {
+	const uint8_t bufLines = scrBufHeight * TileMemHeight;
+	uint8_t src = lineMap[line];
+	if (src >= bufLines) return LineBlank;
+	if ((splitLine == 0) || (line < splitLine)) {
+		// from the scroll origin, wrapped around the screen buffer rows
+		uint8_t room = bufLines - originLine;
+		if (src >= room) src -= room;
+		else src += originLine;
+	}
+	return src;
+}
+#endif
+
+// black line outside of the active rows or from the line map
+inline void hideLine() {
+	lineHidden = (viewLine < viewFirst) || (viewLine >= viewEnd);
+#ifndef SCREEN_INDEX_MAP
+	if (pixLine == LineBlank) lineHidden = 1;	// black line of the line map (the index map buffer can reach the pixel line 255)
+#endif
+}
+#endif
+
+// the lines left in the frame are rendered black, the frame begin latches the new state
+inline void holdFrame() {
+#ifdef RASTER_EFFECTS
+	viewEnd = 0;
+#else
+	lineEvent = activeLines - 1;
+#endif
+	lineHidden = 1;
+	linePhase = PhaseBlank;
+}
+
+#ifndef RASTER_EFFECTS
+// the next line begins or ends the active rows, or the active zone ends (no test per pixel line)
+inline void lineEventReached() {
+	if (lineEvent + 1 == activeLines) linePhase = PhaseBlank;
+	else if (lineHidden != 0) {
+		lineHidden = 0;
+		linePhase = PhaseActive;
+		lineEvent = (unsigned int)viewEnd * lineScaling;
+		if (lineEvent >= activeLines) lineEvent = activeLines - 1;
+	}
+	else {
+		lineHidden = 1;
+		linePhase = PhaseBlank;
+		lineEvent = activeLines - 1;
+	}
+}
+#endif
+
+// scrolling origin latched at frame begin
+inline void latchScrolling() {
+	if (scrollMutex == 0) scrollLine = yScroll + TileScroll;
+	pixLine = scrollLine;	// ring addressed screen buffer origin
+	xScrollPhase ^= 1;
+	if (activeMutex == 0) {
+		viewFirst = activeLineFirst;
+		viewEnd = activeLineEnd;
+	}
+#ifdef RASTER_EFFECTS
+	viewLine = 0;
+#ifndef SCREEN_INDEX_MAP
+	originLine = pixLine;
+	if (lineMapMutex == 0) lineMap = lineMapNext;
+	if (lineMap != NULL) pixLine = mapLine(0);
+#endif
+	hideLine();
+#else
+	// the active rows begin and end on line events, the lines above them are black from the frame begin
+	lineHidden = 0;
+	lineEvent = activeLines - 1;
+	if (viewEnd <= viewFirst) lineHidden = 1;	// no active row
+	else if (viewFirst != 0) {
+		lineHidden = 1;
+		lineEvent = (unsigned int)viewFirst * lineScaling;
+	}
+	else if ((unsigned int)viewEnd * lineScaling < activeLines - 1) lineEvent = (unsigned int)viewEnd * lineScaling;
+#endif
+	applyRowMode(0);
+	applyRowScroll(0);
+#ifdef RASTER_EFFECTS
+	applyRowColor(0);
+	rasterNext = rasterLine;
+#endif
+}
+
+#ifdef SCREEN_INDEX_MAP
+// resolve the tile indexes of the expanded row into the back row buffer
+inline void expandTiles(uint8_t count) {
+	uint8_t col = expandCol;
+	if (col >= scrBufWidthInTile) return;	// row completed
+	if (count > scrBufWidthInTile - col) count = scrBufWidthInTile - col;
+	expandCol = col + count;
+	uint8_t* pIdx = &scrBuf[(unsigned int)expandRow * scrBufWidthInTile + col];
+	volatile uint8_t** pDst = &scrRowBuf[scrRowBack][col];
+	for (; count > 0; count--) {
+		uint8_t idx = *pIdx++;
+		if (idx < tileset.ramFirst) *pDst++ = framePgm + (unsigned int)idx * tileset.size;
+		else *pDst++ = frameRam + (unsigned int)(uint8_t)(idx - tileset.ramFirst) * tileset.size;
+	}
+}
+
+// the expanded row becomes the rendered one and the expansion of the following row begins
+inline void nextTileRow() {
+	uint8_t rendered = scrRowFront;
+	scrRowFront = scrRowBack;
+	scrRowBack = (rendered == 2) ? (scrRowFront ^ 1) : rendered;	// the split row buffer is kept
+	if (++expandRow >= scrBufHeight) expandRow = 0;
+	expandCol = 0;
+}
+
+#ifdef RASTER_EFFECTS
+// the split row expanded at frame begin is rendered and the expansion continues below
+inline void splitTileRow() {
+	scrRowFront = 2;
+	scrRowBack = 0;
+	expandRow = splitLine / TileMemHeight + 1;
+	if (expandRow >= scrBufHeight) expandRow = 0;
+	expandCol = 0;
+}
+#endif
+#endif
+
+#ifdef SCANLINE_RENDER
+#ifdef PIXEL_HW_MUX
+typedef uint32_t __attribute__((__may_alias__)) TileLine;	// the 4 bytes of a tile line
+#define pgm_read_tile_line(p) pgm_read_dword(p)
+#else
+typedef uint16_t __attribute__((__may_alias__)) TileLine;	// the 2 bytes of a tile line
+#define pgm_read_tile_line(p) pgm_read_word(p)
+#endif
+
+// screen buffer pixel line built into the back line buffer, with its sprites
+inline void setBuildLine(uint8_t line, uint8_t col) {
+	lineBuildLine = line;
+	pLineBuildRow = &scrBuf[(line / TileMemHeight) * (unsigned int)scrBufWidthInTile + col];
+	lineBuildOffset = (line & (TileMemHeight-1)) * TileMemWidth;
+	uint8_t n = 0;
+	for (uint8_t s = 0; s < LineSpriteMax; s++) {
+		if ((lineSprite[s].image == NULL) || ((uint8_t)(line - lineSprite[s].y) >= TileMemHeight)) continue;	// not on this line
+		if (lineSprite[s].x >= LineTiles * TilePixWidth) continue;
+		if (n < LineSpanMax) lineSpan[n++] = s;
+	}
+	while (n < LineSpanMax) lineSpan[n++] = LineSpanNone;
+}
+
+// copy the pixel line of the tiles first to end-1 into the back line buffer (one unrolled tile line copy)
+inline void buildLineTiles(uint8_t first, uint8_t end) {
+	TileLine* pDst = (TileLine*)&lineBuf[lineFront ^ 1][first * TileMemWidth];
+	ScreenCell* pTile = pLineBuildRow + first;
+	for (uint8_t k = first; k < end; k++) {
+		unsigned int adr = (unsigned int)*pTile++ + lineBuildOffset;
+		if (adr & PGM_MARKER) *pDst++ = pgm_read_tile_line(adr & ~PGM_MARKER);
+		else *pDst++ = *(TileLine*)adr;
+	}
+}
+
+// overlay a sprite span into the back line buffer, shifted by whole bytes then by the pixels left (black pixels are transparent)
+inline void buildLineSpan(uint8_t id) {
+	if (id == LineSpanNone) return;
+	LineSprite* pSprite = &lineSprite[id];
+	const uint8_t* pSrc = pSprite->image + (uint8_t)(lineBuildLine - pSprite->y) * TileMemWidth;
+	uint8_t* pDst = &lineBuf[lineFront ^ 1][pSprite->x / TilePixPerByte];
+	uint8_t bytes = LineTiles * TileMemWidth - pSprite->x / TilePixPerByte;	// clipped at the line end
+	if (bytes > TileMemWidth + 1) bytes = TileMemWidth + 1;
+	uint8_t sub = pSprite->x & (TilePixPerByte-1);
+#ifndef PIXEL_HW_MUX
+	unsigned int factor = 0x100 >> (sub * TilePixBits);	// the right shift by the mul of the next byte
+#endif
+	uint8_t prev = 0;
+	for (uint8_t n = 0; n < bytes; n++) {
+		uint8_t cur = (n < TileMemWidth) ? pgm_read_byte(pSrc + n) : 0;
+#ifdef PIXEL_HW_MUX
+		// 2 RGB pixels in the bits 7-5 and 4-2
+		uint8_t pix = (sub == 0) ? (cur & 0xfc) : (((prev & 0x1c) << 3) | ((cur >> 3) & 0x1c));
+		uint8_t t = pix | (pix >> 1) | (pix >> 2);
+		uint8_t mask = ((t & 0x20) ? 0xe0 : 0) | ((t & 0x04) ? 0x1c : 0);
+#else
+		// 4 pixels of 2 bits
+		uint8_t pix = (uint8_t)(prev * factor) | (uint8_t)((cur * factor) >> 8);
+		uint8_t t = (pix | (pix >> 1)) & 0x55;
+		uint8_t mask = t | (t << 1);
+#endif
+		*pDst = (*pDst & ~mask) | pix;
+		pDst++;
+		prev = cur;
+	}
+}
+
+// build the next pixel line into the back line buffer, slice n on the line n of the current pixel line;
+// a slice not run (e.g. a TextMode line) leaves the line to be rendered from its tiles
+inline void buildLineSlice(uint8_t slice) {
+	if (slice != lineBuildStep) return;
+	if (slice == 0) {
+		uint8_t line = pixLine + 1;
+		if (line >= scrBufHeight * TileMemHeight) line = 0;
+		uint8_t mode = lineVGAmode;
+		uint8_t col = TileColOffset;
+#ifdef RASTER_EFFECTS
+		uint8_t next = viewLine + 1;
+		if (next == splitLine) line = splitLine;
+		if ((lineMap != NULL) && (next < LineMapSize)) line = mapLine(next);
+		if (((next & (TileMemHeight-1)) == 0) && (next < scrViewHeight * TileMemHeight)) {
+			mode = rowVGAmode(next / TileMemHeight);
+			col = rowHScroll(next / TileMemHeight) >> 3;
+		}
+		uint8_t shown = (line != LineBlank) && (next >= viewFirst) && (next < viewEnd);
+#else
+		uint8_t shown = lineHidden ^ (lineEvent == vLineActive + lineScaling - 1) ^ 1;	// the active rows can begin or end before the next pixel line
+#endif
+		// the cycles are reserved on the GraphMode lines only
+		if ((lineVGAmode != GraphMode) || (mode != GraphMode) || !shown) return;
+		setBuildLine(line, col);
+		buildLineTiles(0, LineSliceTiles);
+	}
+	else if (slice == 1) {
+		buildLineTiles(LineSliceTiles, LineTiles);
+		buildLineSpan(lineSpan[0]);
+	}
+	else buildLineSpan(lineSpan[1]);
+	lineBuildStep++;
+}
+#endif
+
+// apply one tile row of the command to the screen buffer, returns the rows left
+inline uint8_t applyTileCmd(volatile TileCmd* pCmd, ScreenCell* pBuf) {
+	unsigned int index = pCmd->index;
+	uint8_t rowsLeft = 0;
+	switch (pCmd->cmd) {
+	case UPDATE:
+		pBuf[index] = pCmd->cell;
+		break;
+	case FILL:
+		{
+			ScreenCell cell = pCmd->cell;
+			ScreenCell* pDst = &pBuf[index];
+			for (uint8_t n = pCmd->w; n > 0; n--) {
+				*pDst++ = cell;	// fill one row of the rectangle
+			}
+			pCmd->index = index + scrBufWidthInTile;
+			rowsLeft = --pCmd->h;
+		}
+		break;
+	case BLIT:
+		{
+			ScreenCell cell = pCmd->cell;
+			uint8_t* pMap = (uint8_t*)pCmd->src;
+			uint8_t size = pCmd->arg;
+			ScreenCell* pDst = &pBuf[index];
+			if (pMap == NULL) {
+				for (uint8_t n = pCmd->w; n > 0; n--) {
+					*pDst++ = cell;	// consecutive tiles of the tileset
+					cell += size;
+				}
+				pCmd->cell = cell + (unsigned int)pCmd->skip * size;	// first tile of the next source row
+			}
+			else {
+				for (uint8_t n = pCmd->w; n > 0; n--) {
+					*pDst++ = cell + (unsigned int)pgm_read_byte(pMap++) * size;	// tile from the index map
+				}
+				pCmd->src = (unsigned int)(pMap + pCmd->skip);	// next index map row
+			}
+			pCmd->index = index + scrBufWidthInTile;
+			rowsLeft = --pCmd->h;
+		}
+		break;
+	case COPY:
+		{
+			ScreenCell* pSrc = &pBuf[pCmd->src];
+			ScreenCell* pDst = &pBuf[index];
+			if (pCmd->arg == 0) {
+				for (uint8_t n = pCmd->w; n > 0; n--) {
+					*pDst++ = *pSrc++;	// copy one row from left to right
+				}
+				pCmd->index = index + scrBufWidthInTile;
+				pCmd->src += scrBufWidthInTile;
+			}
+			else {
+				for (uint8_t n = pCmd->w; n > 0; n--) {
+					*pDst-- = *pSrc--;	// copy one row from right to left (overlapping)
+				}
+				pCmd->index = index - scrBufWidthInTile;
+				pCmd->src -= scrBufWidthInTile;
+			}
+			rowsLeft = --pCmd->h;
+		}
+		break;
+	case S_LEFT:
+		{
+			ScreenCell* pSrc = &pBuf[index];
+			ScreenCell* pDst = &pBuf[index-1];
+			for (uint8_t n = 0; n < scrBufWidthInTile-1; n++) {
+				*pDst++ = *pSrc++;	// shift left a complete line
+			}
+			pCmd->index = index + scrBufWidthInTile;
+			rowsLeft = --pCmd->h;
+		}
+		break;
+	case S_RIGHT:
+		{
+			ScreenCell* pSrc = &pBuf[index];
+			ScreenCell* pDst = &pBuf[index+1];
+			for (uint8_t n = 0; n < scrBufWidthInTile-1; n++) {
+				*pDst-- = *pSrc--;	// shift right a complete line
+			}
+			pCmd->index = index - scrBufWidthInTile;
+			rowsLeft = --pCmd->h;
+		}
+		break;
+	case S_UP:
+		{
+			ScreenCell* pSrc = &pBuf[index];
+			ScreenCell* pDst = &pBuf[index-scrBufWidthInTile];
+			for (uint8_t n = 0; n < scrBufWidthInTile; n++) {
+				*pDst++ = *pSrc++;	// shift up a complete line
+			}
+			pCmd->index = index + scrBufWidthInTile;
+			rowsLeft = --pCmd->h;
+		}
+		break;
+	case S_DOWN:
+		{
+			ScreenCell* pSrc = &pBuf[index];
+			ScreenCell* pDst = &pBuf[index+scrBufWidthInTile];
+			for (uint8_t n = 0; n < scrBufWidthInTile; n++) {
+				*pDst-- = *pSrc--;	// shift down a complete line
+			}
+			pCmd->index = index - scrBufWidthInTile;
+			rowsLeft = --pCmd->h;
+		}
+		break;
+	}
+	return rowsLeft;
+}
+
+#ifndef SCREEN_DOUBLE_BUFFER
+// drain the tile command queue within the blanking line budget (a row always fits, checked above)
+inline void processTileQueue() {
+	unsigned int budget = TileQueueBudget;
+	for (uint8_t rows = TileQueueRowMax; (rows > 0) && (TileQueueTail != TileQueueHead); rows--) {
+		volatile TileCmd* pCmd = &TileQueue[TileQueueTail];
+		uint8_t cmd = pCmd->cmd;
+		uint8_t tiles = (cmd == UPDATE) ? 1 : ((cmd >= FILL) ? pCmd->w : scrBufWidthInTile);
+		unsigned int cost = TILE_QUEUE_CMD + tiles * TILE_QUEUE_TILE;
+		if (cost > budget) break;	// continue at next blanking line
+		budget -= cost;
+		if (applyTileCmd(pCmd, scrBuf) == 0) TileQueueTail = (TileQueueTail+1) & (TileQueueSize-1);	// entry completed
+	}
+}
+#endif
+
 void _setDate(unsigned char yy, unsigned char mm, unsigned char dd) {
 	// increment when invalid
 	if ((dd > 31) && ((mm == 1) || (mm == 3) || (mm == 5) || (mm == 7) || (mm == 8) || (mm == 10) || (mm == 12))) { dd = 1; mm++;}
@@ -462,58 +1072,112 @@ void _setTime(unsigned char hh, unsigned char mm, unsigned char ss) {
 	}while( (timeH != hh) || (timeM != mm) || (timeS != ss) );
 }
 	
+// idle sleep until the next H-sync with SLEEP_SYNC (the busy waits keep the ISR entry deterministic)
+// without it, a line begun during a sleep would be shifted by the wake-up cycles the jitter fix does not see
+inline void idleLine() {
+#ifdef SLEEP_SYNC
+	SMCR = bit(SE);	// idle mode, only the timer1 overflow wakes up
+	asm volatile ("sleep");
+	SMCR = 0;
+#endif
+}
+
 // ISR (Hsync pulse based) for the APL core
 ISR (TIMER1_OVF_vect) {
 	static volatile unsigned int vLine = totalLines;
-	static volatile unsigned int vLineActive = activeLines;
-	static volatile uint8_t scalingCnt = 0;
 	static volatile uint8_t blinkCount = 0;
-	//interrupt jitter fix (needed to keep pixels synced from free running timer0)
-	// reference https://github.com/cnlohr/avrcraft/blob/master/terminal/ntsc.c
-	// code source https://github.com/smaffer/vgax/blob/master/VGAX.cpp   
-	asm volatile(
-		"     clr r27               \n\t" //
-		"     lds r26, %[timer0]    \n\t" //
-		"     andi r26, 3           \n\t" //
-		"     call TL               \n\t" //
-		"TL:                        \n\t" //
-		"     pop r31               \n\t" // 1 word
-		"     pop r30               \n\t" // 1 word
-		"     adiw Z, 6+0           \n\t" // 1 word, total 6 words for the previous instructions + offset tuning (0, 1 or 2)
-		"     add r30, r26          \n\t" // 1 word
-		"     adc r31, r27          \n\t" // 1 word
-		"     ijmp                  \n\t" // 1 word   
-		".rept 3+0                  \n\t" // between 3 and 3+offset
-		"     nop                   \n\t" //     
-		".endr                      \n\t" //
-		:
-		: [timer0] "i" (&TCNT0)
-		: "r31", "r30", "r27", "r26"  	  // specify to the compiler the used registers not explicitly taken as parameter  
-	);
+	register uint8_t phase = linePhase;
+#ifndef SLEEP_SYNC
+	// the black lines (porches, V sync, hidden lines) skip the jitter fix and the blitter register saves
+	if (phase == PhaseActive) {
+		//interrupt jitter fix (needed to keep pixels synced from free running timer0)
+		// reference https://github.com/cnlohr/avrcraft/blob/master/terminal/ntsc.c
+		// code source https://github.com/smaffer/vgax/blob/master/VGAX.cpp   
+		asm volatile(
+			"     clr r27               \n\t" //
+			"     lds r26, %[timer0]    \n\t" //
+			"     andi r26, 3           \n\t" //
+			"     call TL               \n\t" //
+			"TL:                        \n\t" //
+			"     pop r31               \n\t" // 1 word
+			"     pop r30               \n\t" // 1 word
+			"     adiw Z, 6+0           \n\t" // 1 word, total 6 words for the previous instructions + offset tuning (0, 1 or 2)
+			"     add r30, r26          \n\t" // 1 word
+			"     adc r31, r27          \n\t" // 1 word
+			"     ijmp                  \n\t" // 1 word   
+			".rept 3+0                  \n\t" // between 3 and 3+offset
+			"     nop                   \n\t" //     
+			".endr                      \n\t" //
+			:
+			: [timer0] "i" (&TCNT0)
+			: "r31", "r30", "r27", "r26"  	  // specify to the compiler the used registers not explicitly taken as parameter  
+		);
+	}
+#endif
  
 	static volatile uint8_t PS2clk_last = 1;
 	register uint8_t PS2clk = PINC & 0x20;
 	register uint8_t PS2bit = (PINC & 0x10) >> 4;
-	register uint8_t VGAmode_t = VGAmode;
 	
-	if (++vLineActive >= activeLines) {
-		VGAmode = Disabled;	// disable when in the non active zone
-	}
-	VGArendering();
-	VGAmode = VGAmode_t;	// restore	
+	++vLineActive;
+	if (phase == PhaseActive) VGArendering();
 	
 	if (vLineActive < activeLines) {
 		vLine++;
-		if (++scalingCnt == verticalScaling) { // instead of division by 3
+		if (++scalingCnt == lineScaling) { // instead of division by 3
 			pixLine++;
-			if(pixLine >= (scrViewHeightInTile * TileMemHeight) + yScroll) pixLine = yScroll;
+			if(pixLine >= scrBufHeight * TileMemHeight) pixLine = 0;	// wrap around the screen buffer rows
 			scalingCnt = 0;
+#ifdef RASTER_EFFECTS
+			viewLine++;
+			if (viewLine == splitLine) {
+				pixLine = splitLine;	// the rows below the split are not scrolled
+#ifdef SCREEN_INDEX_MAP
+				splitTileRow();
+#endif
+			}
+#ifdef SCREEN_INDEX_MAP
+			else if ((pixLine & (TileMemHeight-1)) == 0) nextTileRow();
+#else
+			if ((lineMap != NULL) && (viewLine < LineMapSize)) pixLine = mapLine(viewLine);	// remapped source line
+#endif
+			hideLine();
+			linePhase = lineHidden;	// PhaseBlank (1) for a black line
+			if (((viewLine & (TileMemHeight-1)) == 0) && (viewLine < scrViewHeight * TileMemHeight)) {
+				// mode, horizontal scrolling and color of the screen tile row
+				applyRowMode(viewLine / TileMemHeight);
+				applyRowScroll(viewLine / TileMemHeight);
+				applyRowColor(viewLine / TileMemHeight);
+			}
+			rasterCall();
+#elif defined(SCREEN_INDEX_MAP)
+			if ((pixLine & (TileMemHeight-1)) == 0) nextTileRow();
+#endif
+#ifdef SCANLINE_RENDER
+			buildLineSlice(lineScaling-1);	// the last slice, then the built line is rendered
+			lineBuilt = (lineBuildStep == 3);
+			if (lineBuilt) lineFront ^= 1;
+			lineBuildStep = 0;
+#endif
 		}
+#ifdef SCANLINE_RENDER
+		else buildLineSlice(scalingCnt-1);	// the first slices of the next pixel line during the repeated lines
+#endif
+#ifdef SCREEN_INDEX_MAP
+		expandTiles(TileExpandPerLine);
+#endif
+#ifdef RASTER_EFFECTS
+		if (vLineActive + 1 == activeLines) linePhase = PhaseBlank;	// the active zone ends
+#else
+		if (vLineActive == lineEvent) lineEventReached();
+#endif
 	}	
 	else {
 		// V sync  
+		uint8_t queueLine = 1;	// the sound, clock and frame begin lines leave the tile queue to the other blanking lines
 		if (vLine == 1) {
-			PORTB |= 0x04;  // VSYNC set
+			queueLine = 0;
+			PORTB = (PORTB & 0xfb) | vsyncPulse;  // VSYNC pulse
 
 			// sound update
 			static uint8_t count=0;
@@ -562,10 +1226,11 @@ ISR (TIMER1_OVF_vect) {
 			}
 		}
 	
-		if (vLine == 3) {
-			PORTB &= 0xfb;  // VSYNC cleared
-			ElaspsedTime += 17; // 16.66 ms added (60Hz)
-			if (++tick == 60) { // pseudo 60Hz for the second clock
+		if (vLine == 1 + VGA_VSYNC_LINES) {
+			queueLine = 0;
+			PORTB = (PORTB & 0xfb) | (vsyncPulse ^ 0x04);  // VSYNC idle
+			ElaspsedTime += VGA_FRAME_MS; // 16.66 ms added (60Hz)
+			if (++tick == VGA_FRAME_RATE) { // pseudo 60Hz for the second clock
 				//N.B. ICR1 value 126 gives a faster time clock: 2s/hr. ?? theoretically should be 0.01% slower? over clocking effect?
 				//ICR1 value 127 gives a slower time clock: 30s/hr ??
 				tick = 0;
@@ -575,7 +1240,27 @@ ISR (TIMER1_OVF_vect) {
 		if (++vLine == verticalBackPorchLines) {
 			vLineActive = 0;  // start pixel out at next call
 			scalingCnt = 0; // reset the pointer and counters
-			pixLine = yScroll + TileScroll;	  
+			queueLine = 0;
+#if !defined(SCREEN_INDEX_MAP) && !defined(SCANLINE_RENDER)
+			latchScrolling();
+#ifdef RASTER_EFFECTS
+			splitLine = TileSplit;
+#endif
+#endif
+#if !defined(SCREEN_INDEX_MAP) && defined(RASTER_EFFECTS)
+			rasterCall();
+#endif
+			if (VGAmode == Disabled) holdFrame();	// screen initialization
+			linePhase = lineHidden;	// PhaseBlank (1) for a black line
+#ifdef SCANLINE_RENDER
+			lineBuilt = 0;
+			if ((lineBuildStep == 2) && (lineHidden == 0)) {
+				buildLineSpan(lineSpan[1]);	// the last slice of the first pixel line
+				lineFront ^= 1;
+				lineBuilt = 1;
+			}
+			lineBuildStep = 0;
+#endif
 			if (cursorMutex == 0) {
 				// cursor blinking for text mode only
 				if((++blinkCount == 30) && (cursorTileIndex != 0xffff)) {
@@ -589,55 +1274,99 @@ ISR (TIMER1_OVF_vect) {
 				}
 			}
 		}
-		if (vLine > totalLines) vLine = 1;
+		if (vLine > totalLines) {
+			vLine = 1;
+#ifdef ISR_PROFILE
+			// frame cycles not spent in the ISR (its entry and exit are not measured)
+			phaseCycles[PhaseActive] = isrTicks[PhaseActive] * 8;
+			phaseCycles[PhaseBlank] = isrTicks[PhaseBlank] * 8;
+			mainCycles = (unsigned long)totalLines * (ICR1 + 1) * 8 - phaseCycles[PhaseActive] - phaseCycles[PhaseBlank];
+			isrTicks[PhaseActive] = isrTicks[PhaseBlank] = 0;
+#endif
+		}
 		if ((UCSR0A &(1<<UDRE0)) && (txbuffer.available() == true)) UDR0 = txbuffer.readfast(); // extract from tx ringbuffer and send	
 		
-		switch (TileNext) {
-		case UPDATE:
-			scrBuf[newTileIndexNext] = TilePtrNext;
-			TileNext = NONE; 	// clear the semaphore
-			break;
-		case S_LEFT:
-			{
-				unsigned int *pSrc = (unsigned int *)(&scrBuf[newTileIndexNext]);
-				unsigned int *pDst = (unsigned int *)(&scrBuf[newTileIndexNext-1]);
-				for (uint8_t n = 0; n < scrBufWidthInTile-1; n++) {
-					*pDst++ = *pSrc++;	// shift left a complete line
-				}
-				TileNext = NONE;				
+#ifdef SCREEN_INDEX_MAP
+		// expand the split row and the first two tile rows ahead of the active lines (no tile queue processing)
+		if (vLine == verticalBackPorchLines-3) {
+#ifdef SCREEN_DOUBLE_BUFFER
+			if (presentPending != 0) {
+				// page flip before the first row expansion (tear-free)
+				ScreenCell* page = scrBuf;
+				scrBuf = scrBack;
+				scrBack = page;
+				presentPending = 0;
 			}
-			break;
-		case S_RIGHT:
-			{
-				unsigned int *pSrc = (unsigned int *)(&scrBuf[newTileIndexNext]);
-				unsigned int *pDst = (unsigned int *)(&scrBuf[newTileIndexNext+1]);
-				for (uint8_t n = 0; n < scrBufWidthInTile-1; n++) {
-					*pDst-- = *pSrc--;	// shift right a complete line
-				}
-				TileNext = NONE;
+#endif
+			if (tilesetMutex == 0) {
+				tileset.pgm = tilesetNext.pgm; tileset.ram = tilesetNext.ram;
+				tileset.ramFirst = tilesetNext.ramFirst; tileset.size = tilesetNext.size;
+				tileset.pgmOdd = tilesetNext.pgmOdd; tileset.ramOdd = tilesetNext.ramOdd;
 			}
-			break;
-		case S_UP:
-			{
-				unsigned int *pSrc = (unsigned int *)(&scrBuf[newTileIndexNext]);
-				unsigned int *pDst = (unsigned int *)(&scrBuf[newTileIndexNext-scrBufWidthInTile]);
-				for (uint8_t n = 0; n < scrBufWidthInTile; n++) {
-					*pDst++ = *pSrc++;	// shift up a complete line
-				}
-				TileNext = NONE;
+			// the cells alternate between their two tiles at each frame, a NULL odd tileset keeps the even one
+			oddFrame ^= 1;
+			framePgm = ((oddFrame != 0) && (tileset.pgmOdd != NULL)) ? tileset.pgmOdd : tileset.pgm;
+			frameRam = ((oddFrame != 0) && (tileset.ramOdd != NULL)) ? tileset.ramOdd : tileset.ram;
+#ifdef RASTER_EFFECTS
+			splitLine = TileSplit;
+			if (splitLine != 0) {
+				scrRowBack = 2;
+				expandRow = splitLine / TileMemHeight;
+				expandCol = 0;
+				expandTiles(scrBufWidthInTile);
 			}
-			break;
-		case S_DOWN:
-			{
-				unsigned int *pSrc = (unsigned int *)(&scrBuf[newTileIndexNext]);
-				unsigned int *pDst = (unsigned int *)(&scrBuf[newTileIndexNext+scrBufWidthInTile]);
-				for (uint8_t n = 0; n < scrBufWidthInTile; n++) {
-					*pDst-- = *pSrc--;	// shift down a complete line
+#endif
+		}
+		else if (vLine == verticalBackPorchLines-2) {
+			latchScrolling();
+#ifdef RASTER_EFFECTS
+			rasterCall();
+#endif
+			scrRowFront = 1;
+			scrRowBack = 0;
+			expandRow = pixLine / TileMemHeight;
+			expandCol = 0;
+			expandTiles(scrBufWidthInTile);
+		}
+		else if (vLine == verticalBackPorchLines-1) {
+			nextTileRow();
+			expandTiles(scrBufWidthInTile);
+		}
+#ifndef SCREEN_DOUBLE_BUFFER
+		else if (queueLine) processTileQueue();
+#endif
+#elif defined(SCANLINE_RENDER)
+		// latch the frame and build the first pixel line ahead of the active lines in two slices (no tile queue processing)
+		if (vLine == verticalBackPorchLines-2) {
+			latchScrolling();
+#ifdef RASTER_EFFECTS
+			splitLine = TileSplit;
+#endif
+			if (lineSpriteMutex == 0) {
+				for (uint8_t s = 0; s < LineSpriteMax; s++) {
+					lineSprite[s].image = lineSpriteNext[s].image;
+					lineSprite[s].x = lineSpriteNext[s].x;
+					lineSprite[s].y = lineSpriteNext[s].y;
 				}
-				TileNext = NONE;					
 			}
-			break;
+			lineBuildStep = 0;
+			if ((lineVGAmode == GraphMode) && (lineHidden == 0)) {
+				setBuildLine(pixLine, TileColOffset);
+				buildLineTiles(0, LineSliceTiles);
+				lineBuildStep = 1;
+			}
+		}
+		else if (vLine == verticalBackPorchLines-1) {
+			if (lineBuildStep == 1) {
+				buildLineTiles(LineSliceTiles, LineTiles);
+				buildLineSpan(lineSpan[0]);
+				lineBuildStep = 2;
+			}
 		}
+		else if (queueLine) processTileQueue();
+#else
+		if (queueLine) processTileQueue();
+#endif
 	}
   
 	// alternate between PS2 and UART handling
@@ -658,6 +1387,74 @@ ISR (TIMER1_OVF_vect) {
 		}		
 	}	
 	PS2clk_last = PS2clk;
+#ifdef ISR_PROFILE
+	isrTicks[phase] += TCNT1;	// ISR duration from the timer overflow
+#endif
+}
+
+// the tile has a cell: with SCREEN_INDEX_MAP, a tile of the active tileset in the index range of its memory
+bool pgmTileValid(const uint8_t* TilePtr) {
+#ifdef SCREEN_INDEX_MAP
+	unsigned int offset = (unsigned int)TilePtr - ((unsigned int)tilesetNext.pgm & ~PGM_MARKER);	// wraps above the range when below the tileset
+	return ((offset % tilesetNext.size) == 0) && ((offset / tilesetNext.size) < tilesetNext.ramFirst);
+#else
+	(void)TilePtr;
+	return true;
+#endif
+}
+
+bool ramTileValid(uint8_t* TilePtr) {
+#ifdef SCREEN_INDEX_MAP
+	unsigned int offset = (unsigned int)TilePtr - (unsigned int)tilesetNext.ram;
+	return (tilesetNext.ram != NULL) && ((offset % tilesetNext.size) == 0) && ((offset / tilesetNext.size) <= (unsigned int)(0xff - tilesetNext.ramFirst));
+#else
+	(void)TilePtr;
+	return true;
+#endif
+}
+
+// tile pointer to screen cell conversions
+ScreenCell pgmTileCell(const uint8_t* TilePtr) {
+#ifdef SCREEN_INDEX_MAP
+	return (uint8_t)(((unsigned int)TilePtr - ((unsigned int)tilesetNext.pgm & ~PGM_MARKER)) / tilesetNext.size);
+#else
+	return (ScreenCell)((unsigned int)TilePtr | PGM_MARKER);
+#endif
+}
+
+ScreenCell ramTileCell(uint8_t* TilePtr) {
+#ifdef SCREEN_INDEX_MAP
+	return tilesetNext.ramFirst + (uint8_t)(((unsigned int)TilePtr - (unsigned int)tilesetNext.ram) / tilesetNext.size);
+#else
+	return TilePtr;
+#endif
+}
+
+uint8_t* cellTilePtr(ScreenCell cell) {
+#ifdef SCREEN_INDEX_MAP
+	if (cell < tilesetNext.ramFirst) return (uint8_t*)(((unsigned int)tilesetNext.pgm & ~PGM_MARKER) + (unsigned int)cell * tilesetNext.size);
+	return tilesetNext.ram + (unsigned int)(uint8_t)(cell - tilesetNext.ramFirst) * tilesetNext.size;
+#else
+	return (uint8_t*)((unsigned int)cell & ~PGM_MARKER);
+#endif
+}
+
+// the cell is a RAM tile
+bool cellIsRAM(ScreenCell cell) {
+#ifdef SCREEN_INDEX_MAP
+	return (cell >= tilesetNext.ramFirst);
+#else
+	return (((unsigned int)cell & PGM_MARKER) == 0);
+#endif
+}
+
+// DDRD color pins (R0,G0, B0, R1, G1, B1 on portd pins 2 to 7)
+uint8_t colorPins(uint8_t color) {
+	uint8_t mask = 0;
+	if (color & RED) 	mask |= 0b10010000;
+	if (color & GREEN)	mask |= 0b01001000;
+	if (color & BLUE)	mask |= 0b00100100;
+	return mask;
 }
 
 APLcore::APLcore() {
@@ -668,26 +1465,37 @@ APLcore::APLcore() {
 void APLcore::coreInit() {
 	
 	TWCR = 0;			// disable the 2-wire serial interface
+#ifdef SCANLINE_RENDER
+	for (uint8_t k = 0; k < LineTiles; k++) {
+		lineTile[0][k] = &lineBuf[0][k * TileMemWidth];
+		lineTile[1][k] = &lineBuf[1][k * TileMemWidth];
+	}
+#endif
 
 	initScreenBuffer(TextMode); // includes ports initialization
 
 	DDRB |= 0x05;  // portb outputs: VSYNC assigned PB2 (Arduino pin D10), PB0 as output for pixelMux
+	PORTB = (PORTB & 0xfb) | (vsyncPulse ^ 0x04);  // VSYNC idle level of the profile
 	DDRC &= 0xcf;  // portc inputs: PS2 Keyboard clk on PC5, data PC4	
 
 	// disable Timer 0
 	TIMSK0 = 0;  // no interrupts on Timer 0
 	TCCR0A=0;
+#ifdef SLEEP_SYNC
+	TCCR0B=0; //stopped, the ISR entry is synchronized by the sleeping main loop (Timer 0 left to the user)
+#else
 	TCCR0B=1; //enable ext clock counter (used to fix the HSYNC interrupt jitter)
+#endif
 	OCR0A = 0;   // and turn it off
 	OCR0B = 0;
 	TCNT0=0;
 
-	// Timer 1 - Horizontal Sync period: (1/60) / 525 * 1e6 = 31.746 uS  
+	// Timer 1 - Horizontal Sync period: (1/60) / 525 * 1e6 = 31.746 uS at 640x480 (VGA_TIMING profile)
 	DDRB |= 0x02;  // HSYNC assigned PB1 (Arduino pin D9)
-	TCCR1A=bit(WGM11) | bit(COM1A1);
+	TCCR1A=bit(WGM11) | bit(COM1A1) | ((VGA_SYNC_POSITIVE & 1) ? 0 : bit(COM1A0));	// inverted output for a negative pulse
 	TCCR1B=bit(WGM12) | bit(WGM13) | bit(CS11); //8 prescaler
-	ICR1=31.75F * F_CPU / 1000000 / 8UL - 1; //(period: 31.746 uS round-up to 31.75uS) * (FClk/8) - 1
-	OCR1A= 4 * F_CPU / 1000000 / 8UL - 1; //(tOn: 4 uS) * (FClk/8) - 1 = 7
+	ICR1=LINE_CYCLES / 8 - 1; //(period: 31.746 uS round-up to 31.75uS) * (FClk/8) - 1
+	OCR1A= F_CPU / 8 * VGA_HSYNC_QUS / 4000000 - 1; //(tOn: 4 uS) * (FClk/8) - 1 = 7
 	TIFR1=bit(TOV1); //clear overflow flag
 	TIMSK1=bit(TOIE1); //interrupt on overflow on TIMER1
 
@@ -738,16 +1546,50 @@ void APLcore::setColor(uint8_t color, uint8_t mode) {
 #endif
 
 	// (R0,G0, B0, R1, G1, B1) color assigned portd pins 2 to 7 as outputs, without changing the value of pins 0 & 1, which are RX & TX  
-	DDRD &= 0b00000011;
-	if (screenColor & RED) 	DDRD |= 0b10010000;
-	if (screenColor & GREEN)DDRD |= 0b01001000;
-	if (screenColor & BLUE)	DDRD |= 0b00100100;
+	colorMask = colorPins(screenColor);
+	DDRD = (DDRD & 0b00000011) | colorMask;
+#ifdef SCREEN_INDEX_MAP
+	if (mode == TextMode) setTileset(pFont, NULL, 0xff, FontMemSize);	// font of the color, VGAmode may not be set yet
+#endif
 }
 
 void APLcore::initScreenBuffer() {
 	initScreenBuffer(VGAmode);
 }
 
+#ifdef SCREEN_240_LINES
+void APLcore::initScreenBuffer(uint8_t mode, uint8_t scaling) {
+	// validate the mode and the scaling
+	if((mode != TextMode) && (mode != GraphPgmMode) && (mode != GraphMode)) return;
+	if((scaling != verticalScaling) && (scaling != verticalScaling240)) return;
+	holdFrame();	// the frame ends black, the rows restart at the next frame begin
+	lineScaling = scaling;
+	scalingCnt = 0;	// the ISR would miss the match of a smaller scaling
+	scrViewHeight = (scaling == verticalScaling240) ? scrViewHeightInTile240 : scrViewHeightInTile;
+	scrBufHeight = scrViewHeight + 1;
+	initScreenBuffer(mode);
+	setActiveRows(0, scrViewHeight);
+}
+#endif
+
+void APLcore::fillScreenBuffer(const uint8_t* pgmTileset, uint8_t tileSize, const uint8_t* evenTile, const uint8_t* oddTile) {
+#ifdef SCREEN_INDEX_MAP
+	setTileset(pgmTileset, NULL, 0xff, tileSize);	// default tileset of the mode, VGAmode is Disabled
+#else
+	(void)pgmTileset;	// the cells are the tile pointers
+	(void)tileSize;
+#endif
+	ScreenCell evenCell = pgmTileCell(evenTile);
+	ScreenCell oddCell = pgmTileCell(oddTile);
+	for (unsigned int y = 0; y < srcBufSize; y++) {
+		if(y&1) scrBuf[y] = oddCell;
+		else scrBuf[y] = evenCell;
+#ifdef SCREEN_DOUBLE_BUFFER
+		scrBack[y] = scrBuf[y];
+#endif
+	}
+}
+
 void APLcore::initScreenBuffer(uint8_t mode) {	
 	// validate the mode
 	if((mode != TextMode) && (mode != GraphPgmMode) && (mode != GraphMode)) return;
@@ -757,27 +1599,21 @@ void APLcore::initScreenBuffer(uint8_t mode) {
 		MemWidth = FontMemWidth;
 		
 		VGAmode = Disabled;
+		holdFrame();
 		if (mode != VGAmode) setColor(GREEN, TextMode); // init the color when mode changes
 		
 		// initialize the screen memory with valid content
-		for (unsigned int y = 0; y < srcBufSize; y++) {			
-			scrBuf[y] = (uint8_t*)&pFont[(unsigned int)FontMemSize * ' '];
-		}		
+		fillScreenBuffer(pFont, FontMemSize, &pFont[(unsigned int)FontMemSize * ' '], &pFont[(unsigned int)FontMemSize * ' ']);
 		VGAmode = TextMode;	// restart VGA rendering	
 	}
 	else {
 		MemWidth = TileMemWidth;
 				
 		VGAmode = Disabled;
+		holdFrame();
 		if (mode != VGAmode) setColor(WHITE, GraphMode); // init the color when mode changes
-		//initialize the screen memory with valid content
-		for (unsigned int y = 0; y < srcBufSize; y++) {    
-			//scrBuf[y] = &coreTile4B[TileMemSize4B * 0];  // black tile
-			if(y&1) scrBuf[y] = (volatile uint8_t*)&coreTile4B[TileMemSize4B * 4];  // checkerboard tile
-			else scrBuf[y] = (volatile uint8_t*)&coreTile4B[TileMemSize4B * 2];  // square tile
-			//else scrBuf[y] = &coreTile4B[TileMemSize4B * 3];  // full tile			
-			scrBuf[y] = (uint8_t*)((unsigned int)scrBuf[y] | PGM_MARKER);		// add pgm marker
-		}
+		//initialize the screen memory with valid content: square and checkerboard tiles
+		fillScreenBuffer(coreTile4B, TileMemSize4B, &coreTile4B[TileMemSize4B * 2], &coreTile4B[TileMemSize4B * 4]);
 		VGAmode = GraphMode; // restart VGA rendering
 	}	
 #else
@@ -786,9 +1622,8 @@ void APLcore::initScreenBuffer(uint8_t mode) {
 	if(mode == TextMode) {		
 		MemWidth = FontMemWidth;
 		VGAmode = Disabled;
-		for (unsigned int y = 0; y < srcBufSize; y++) {			
-			scrBuf[y] = (uint8_t*)&pFont[(unsigned int)FontMemSize * ' '];			
-		}
+		holdFrame();
+		fillScreenBuffer(pFont, FontMemSize, &pFont[(unsigned int)FontMemSize * ' '], &pFont[(unsigned int)FontMemSize * ' ']);
 		VGAmode = TextMode;	
 	}
 	else {
@@ -796,12 +1631,8 @@ void APLcore::initScreenBuffer(uint8_t mode) {
 			MemWidth = TileMemWidth4B;
 			// initialize the screen memory with valid content
 			VGAmode = Disabled;
-			for (unsigned int y = 0; y < srcBufSize; y++) {
-				//scrBuf[y] = (volatile uint8_t*)&coreTile4B[TileMemSize4B * 0];  // black tile
-				if(y&1) scrBuf[y] = (volatile uint8_t*)&coreTile4B[TileMemSize4B * 1];  // checkerboard tile
-				else scrBuf[y] = (volatile uint8_t*)&coreTile4B[TileMemSize4B * 2];  // square tile
-				scrBuf[y] = (uint8_t*)((unsigned int)scrBuf[y] | PGM_MARKER);		// add pgm marker
-			}			
+			holdFrame();
+			fillScreenBuffer(coreTile4B, TileMemSize4B, &coreTile4B[TileMemSize4B * 2], &coreTile4B[TileMemSize4B * 1]);	// square and checkerboard tiles
 			VGAmode = GraphPgmMode;			
 			setColor(WHITE);
 		}
@@ -809,12 +1640,8 @@ void APLcore::initScreenBuffer(uint8_t mode) {
 			MemWidth = TileMemWidth;
 			// initialize the screen memory with valid content
 			VGAmode = Disabled;
-			for (unsigned int y = 0; y < srcBufSize; y++) {    
-				//scrBuf[y] = (volatile uint8_t*)&coreTile2B[TileMemSize * 0];  // black tile
-				if(y&1) scrBuf[y] = (volatile uint8_t*)&coreTile2B[TileMemSize * 1];  // checkerboard tile
-				else scrBuf[y] = (volatile uint8_t*)&coreTile2B[TileMemSize * 2];  // square tile
-				scrBuf[y] = (uint8_t*)((unsigned int)scrBuf[y] | PGM_MARKER);		// add pgm marker
-			}			
+			holdFrame();
+			fillScreenBuffer(coreTile2B, TileMemSize, &coreTile2B[TileMemSize * 2], &coreTile2B[TileMemSize * 1]);	// square and checkerboard tiles
 			VGAmode = GraphMode;
 			setColor(RED|GREEN);
 		}
@@ -823,12 +1650,22 @@ void APLcore::initScreenBuffer(uint8_t mode) {
 	// critical section
 	cursorMutex = 1;	// set the mutex	
 	cursorTileIndex = 0xffff; // by default deactivate cursor
-	cursorOnTile = (uint8_t*)&pFont[(unsigned int)FontMemSize * '_'];
-	cursorOffTile = (uint8_t*)&pFont[(unsigned int)FontMemSize * ' '];
+	cursorOnTile = pgmTileCell(&pFont[(unsigned int)FontMemSize * '_']);
+	cursorOffTile = pgmTileCell(&pFont[(unsigned int)FontMemSize * ' ']);
 	cursorMutex = 0;	// release the mutex
 	xScroll = yScroll = 0;	
+	TileScroll = TileColScroll = 0;
+#ifdef RASTER_EFFECTS
+	TileSplit = 0;
+	clearRowScroll();
+	for (uint8_t row = 0; row < scrViewHeightInTileMax; row++) rowColor[row] = rowMode[row] = 0;
+#endif
 }
 	
+uint8_t APLcore::getscrViewHeightInTile() {
+	return scrViewHeight;
+}
+
 uint8_t APLcore::getscrViewWidthInTile() {
 	uint8_t retVal = 0;
 	switch (VGAmode) {
@@ -843,67 +1680,191 @@ uint8_t APLcore::getscrViewWidthInTile() {
 }
 
 uint8_t APLcore::getTileMemSize() {
+	if (VGAmode == TextMode) return FontMemSize;	// the font lines are doubled with TILE_HEIGHT_16
 	return MemWidth*TileMemHeight;		
 }
 
 #pragma GCC push_options
 #pragma GCC optimize ("O0") // avoid optimization to ensure volatile variable propriety
+bool pushTileCmd(uint8_t cmd, unsigned int index, ScreenCell cell, uint8_t w, uint8_t h, uint8_t arg = 0, unsigned int src = 0, uint8_t skip = 0) {
+#ifdef SCREEN_DOUBLE_BUFFER
+	TileCmd tileCmd = {cmd, w, h, arg, skip, index, cell, src};
+	while (applyTileCmd(&tileCmd, scrBack) != 0);	// composed directly into the back page
+	return true;
+#else
+	uint8_t head = TileQueueHead;
+	uint8_t next = (head+1) & (TileQueueSize-1);
+	if (next == TileQueueTail) return false;	// queue full
+	volatile TileCmd* pCmd = &TileQueue[head];
+	pCmd->cmd = cmd;
+	pCmd->w = w;
+	pCmd->h = h;
+	pCmd->arg = arg;
+	pCmd->skip = skip;
+	pCmd->index = index;
+	pCmd->cell = cell;
+	pCmd->src = src;
+	TileQueueHead = next;	// publish the entry to the ISR
+	return true;
+#endif
+}
+
+#ifdef SCREEN_DOUBLE_BUFFER
+bool APLcore::isTileQueueEmpty() {
+	return true;	// no queue, the tile commands are applied to the back page at once
+}
+
 uint8_t* APLcore::getTileXY(uint8_t x, uint8_t y) {
-  while(TileNext != NONE);
-  return (uint8_t*)((unsigned int)scrBuf[(unsigned int)scrBufWidthInTile * y + x] & (~(unsigned int)PGM_MARKER));
+  return cellTilePtr(scrBack[(unsigned int)scrBufWidthInTile * y + x]);
+}
+
+bool APLcore::isRAMTileXY(uint8_t x, uint8_t y) {
+  return cellIsRAM(scrBack[(unsigned int)scrBufWidthInTile * y + x]);
+}
+
+uint8_t APLcore::getTileIndexXY(uint8_t x, uint8_t y) {
+  return scrBack[(unsigned int)scrBufWidthInTile * y + x];
+}
+
+void APLcore::present(bool keepFrame) {
+	presentPending = 1;
+	while(presentPending != 0) idleLine();	// wait for the page flip at the next frame begin
+	if (keepFrame) {
+		// the new back page starts from the displayed frame
+		for (unsigned int i = 0; i < srcBufSize; i++) scrBack[i] = scrBuf[i];
+	}
+}
+#else
+bool APLcore::isTileQueueEmpty() {
+	return (TileQueueTail == TileQueueHead);
+}
+
+uint8_t* APLcore::getTileXY(uint8_t x, uint8_t y) {
+  while(TileQueueTail != TileQueueHead) idleLine();	// wait until all pending updates are applied
+  return cellTilePtr(scrBuf[(unsigned int)scrBufWidthInTile * y + x]);
+}
+
+bool APLcore::isRAMTileXY(uint8_t x, uint8_t y) {
+  while(TileQueueTail != TileQueueHead) idleLine();	// wait until all pending updates are applied
+  return cellIsRAM(scrBuf[(unsigned int)scrBufWidthInTile * y + x]);
+}
+
+#ifdef SCREEN_INDEX_MAP
+uint8_t APLcore::getTileIndexXY(uint8_t x, uint8_t y) {
+  while(TileQueueTail != TileQueueHead) idleLine();	// wait until all pending updates are applied
+  return scrBuf[(unsigned int)scrBufWidthInTile * y + x];
+}
+#endif
+#endif
+
+#ifdef SCREEN_INDEX_MAP
+
+void APLcore::setTileIndexXY(uint8_t x, uint8_t y, uint8_t index) {
+	while(pushTileCmd(UPDATE, (unsigned int)scrBufWidthInTile * y + x, index, 1, 1) == false) idleLine();
+}
+
+void APLcore::setTileset(const uint8_t* pgmTileset, uint8_t* ramTileset, uint8_t ramFirstIndex) {
+	setTileset(pgmTileset, ramTileset, ramFirstIndex, getTileMemSize());
+}
+
+void APLcore::setTileset(const uint8_t* pgmTileset, uint8_t* ramTileset, uint8_t ramFirstIndex, uint8_t tileSize) {
+	// critical section
+	tilesetMutex = 1;	// set the mutex
+	tilesetNext.pgm = (uint8_t*)((unsigned int)pgmTileset | PGM_MARKER);
+	tilesetNext.ram = ramTileset;
+	tilesetNext.ramFirst = ramFirstIndex;
+	tilesetNext.size = tileSize;
+	tilesetNext.pgmOdd = NULL;	// no temporal dithering
+	tilesetNext.ramOdd = NULL;
+	tilesetMutex = 0;	// release the mutex
+}
+
+void APLcore::setTilesetOdd(const uint8_t* pgmTileset, uint8_t* ramTileset) {
+	// critical section
+	tilesetMutex = 1;	// set the mutex
+	tilesetNext.pgmOdd = (pgmTileset != NULL) ? (uint8_t*)((unsigned int)pgmTileset | PGM_MARKER) : NULL;
+	tilesetNext.ramOdd = ramTileset;
+	tilesetMutex = 0;	// release the mutex
+}
+#endif
+
+bool APLcore::trySetRAMTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr) {
+	if (!ramTileValid(TilePtr)) return true;	// rejected, nothing to retry
+	return pushTileCmd(UPDATE, (unsigned int)scrBufWidthInTile * y + x, ramTileCell(TilePtr), 1, 1);
+}
+
+bool APLcore::trySetTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr) {
+	if (!pgmTileValid(TilePtr)) return true;	// rejected, nothing to retry
+	return pushTileCmd(UPDATE, (unsigned int)scrBufWidthInTile * y + x, pgmTileCell(TilePtr), 1, 1);
 }
 
 void APLcore::setRAMTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr) {
-	unsigned int tmp = (unsigned int)scrBufWidthInTile * y + x;
-	while(TileNext != NONE);
-	newTileIndexNext = tmp;
-	TilePtrNext = TilePtr;
-	TileNext = UPDATE;	// set the semaphore
+	while(trySetRAMTileXY(x, y, TilePtr) == false) idleLine();
 }
 
 void APLcore::setTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr) {
-	unsigned int tmp = (unsigned int)scrBufWidthInTile * y + x;
-	while(TileNext != NONE);
-	newTileIndexNext = tmp;
-	TilePtrNext = (uint8_t*)((unsigned int)TilePtr | PGM_MARKER);
-	TileNext = UPDATE;	// set the semaphore
+	while(trySetTileXY(x, y, TilePtr) == false) idleLine();
+}
+
+void APLcore::fillTiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t* TilePtr) {
+	if ((w == 0) || (h == 0) || !pgmTileValid(TilePtr)) return;
+	while(pushTileCmd(FILL, (unsigned int)scrBufWidthInTile * y + x, pgmTileCell(TilePtr), w, h) == false) idleLine();
+}
+
+void APLcore::blitTileMap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* indexMap, uint8_t srcW, const uint8_t* tileset, uint8_t tileSize) {
+	if ((w == 0) || (h == 0)) return;
+#ifdef SCREEN_INDEX_MAP
+	tileSize = 1;	// the cells are indexes of the active tileset
+#endif
+	if (x >= scrBufWidthInTile) return;
+	if (w > scrBufWidthInTile - x) w = scrBufWidthInTile - x;	// clipped at the buffer row end
+	uint8_t skip = (srcW > w) ? srcW - w : 0;	// the area is the top left part of the source
+	while(pushTileCmd(BLIT, (unsigned int)scrBufWidthInTile * y + x, pgmTileCell(tileset), w, h, tileSize, (unsigned int)indexMap, skip) == false) idleLine();
+}
+
+void APLcore::copyTiles(uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h, uint8_t dstX, uint8_t dstY) {
+	if ((w == 0) || (h == 0)) return;
+	unsigned int src = (unsigned int)scrBufWidthInTile * srcY + srcX;
+	unsigned int dst = (unsigned int)scrBufWidthInTile * dstY + dstX;
+	if (dst <= src) {
+		while(pushTileCmd(COPY, dst, 0, w, h, 0, src) == false) idleLine();
+	}
+	else {
+		// overlapping copy starts from the bottom right tile
+		unsigned int last = (unsigned int)scrBufWidthInTile * (h-1) + (w-1);
+		while(pushTileCmd(COPY, dst + last, 0, w, h, 1, src + last) == false) idleLine();
+	}
 }
 
 void APLcore::shiftLeftTile() {
-	for (unsigned int n = 1; n < srcBufSize; n+=scrBufWidthInTile) {
-		while(TileNext != NONE);
-		newTileIndexNext = n;		// src index
-		TileNext = S_LEFT;	// set the semaphore
-	}	
+	while(pushTileCmd(S_LEFT, 1, 0, 0, scrBufHeight) == false) idleLine();
 }
 
 void APLcore::shiftRightTile() {
-	for (signed int n = srcBufSize-2; n > 0; n-=scrBufWidthInTile) {
-		while(TileNext != NONE);
-		newTileIndexNext = (unsigned int)n;		// src index
-		TileNext = S_RIGHT;	// set the semaphore
-	}
+	while(pushTileCmd(S_RIGHT, (unsigned int)scrBufWidthInTile * scrBufHeight - 2, 0, 0, scrBufHeight) == false) idleLine();
 }
 
 void APLcore::shiftUpTile() {
-	for (unsigned int n = scrBufWidthInTile; n < srcBufSize; n+=scrBufWidthInTile) {
-		while(TileNext != NONE);
-		newTileIndexNext = n;		// src index
-		TileNext = S_UP;	// set the semaphore
-	}
+	while(pushTileCmd(S_UP, scrBufWidthInTile, 0, 0, scrBufHeight-1) == false) idleLine();
 }
 
 void APLcore::shiftDownTile() {
-	for (signed int n = srcBufSize-1-scrBufWidthInTile; n > 0; n-=scrBufWidthInTile) {
-		while(TileNext != NONE);
-		newTileIndexNext = (unsigned int)n;		// src index
-		TileNext = S_DOWN;	// set the semaphore
-	}
+	while(pushTileCmd(S_DOWN, (unsigned int)scrBufWidthInTile * (scrBufHeight-1) - 1, 0, 0, scrBufHeight-1) == false) idleLine();
 }
 #pragma GCC pop_options
 
 void APLcore::setTileXYtext(uint8_t x, uint8_t y, char c) { 
-	setTileXY(x, y, &pFont[(unsigned int)c * FontMemSize]);
+	uint8_t* font = pFont;
+#if !defined(PIXEL_HW_MUX) && !defined(SCREEN_INDEX_MAP) && defined(RASTER_EFFECTS)
+	// the mono fonts are aligned to the pins of their color (the index map has a single font tileset)
+	if (y < scrViewHeight) {
+		uint8_t mask = rowColor[y];
+		if (mask & colorPins(RED)) font = (uint8_t*)&fontRed[0];
+		else if (mask & colorPins(GREEN)) font = (uint8_t*)&fontGreen[0];
+		else if (mask & colorPins(BLUE)) font = (uint8_t*)&fontBlue[0];
+	}
+#endif
+	setTileXY(x, y, &font[(unsigned int)c * FontMemSize]);
 }	
 
 void APLcore::setCursor(uint8_t x, uint8_t y, bool active) { 
@@ -927,19 +1888,185 @@ void APLcore::setCursorXY(uint8_t x, uint8_t y) {
 
 void APLcore::setXScroll(uint8_t scrollValue) {
 #ifndef NO_XSCROLLING
-	if(VGAmode != TextMode) xScroll = scrollValue & 0b110;
+	if(VGAmode != TextMode) {
+		xScroll = scrollValue & 0b111;
+		// 7 alternates with the next tile column, not available on the last origin column
+		if ((xScroll == 7) && (TileColScroll >= scrBufWidthInTile - getscrViewWidthInTile() - 1)) xScroll = 6;
+	}
+#else
+	(void)scrollValue;	// no fine horizontal scrolling
 #endif
 }
 
 void APLcore::setYScroll(uint8_t scrollValue) {
-  if(VGAmode != TextMode) yScroll = scrollValue & 0b111;
+  yScroll = scrollValue & (TileMemHeight-1);
 }
 
 void APLcore::setTileScroll(uint8_t scrollValue) {
-  if (scrollValue > scrViewHeightInTile-1) TileScroll = (scrViewHeightInTile-1) * TileMemHeight;
+  if (scrollValue > scrBufHeight-1) TileScroll = (scrBufHeight-1) * TileMemHeight;
   else TileScroll = scrollValue * TileMemHeight;
 }
 
+#pragma GCC push_options
+#pragma GCC optimize ("O0") // avoid optimization to ensure volatile variable proprieties
+void APLcore::scrollUp(uint8_t pixels) {
+	// the fine scrolling carries into the buffer rows, the rows wrap around (no copy)
+	unsigned int line = (unsigned int)TileScroll + yScroll + pixels;
+	unsigned int bufLines = (unsigned int)scrBufHeight * TileMemHeight;
+	while (line >= bufLines) line -= bufLines;
+	// critical section
+	scrollMutex = 1;	// set the mutex
+	TileScroll = line & ~(TileMemHeight-1);
+	yScroll = line & (TileMemHeight-1);
+	scrollMutex = 0;	// release the mutex
+}
+#pragma GCC pop_options
+
+uint8_t APLcore::getBufferRow(uint8_t viewRow) {
+	uint8_t row = TileScroll / TileMemHeight + viewRow;
+	while (row >= scrBufHeight) row -= scrBufHeight;
+	return row;
+}
+
+#ifdef SCANLINE_RENDER
+#pragma GCC push_options
+#pragma GCC optimize ("O0") // avoid optimization to ensure volatile variable proprieties
+void APLcore::setLineSprite(uint8_t id, const uint8_t* image, uint8_t x, uint8_t y) {
+	if (id >= LineSpriteMax) return;
+	// critical section
+	lineSpriteMutex = 1;	// set the mutex
+	lineSpriteNext[id].image = image;
+	lineSpriteNext[id].x = x;
+	lineSpriteNext[id].y = y;
+	lineSpriteMutex = 0;	// release the mutex
+}
+#pragma GCC pop_options
+#endif
+
+void APLcore::setScrollOrigin(uint8_t col, uint8_t row) {
+	// the rendered columns cannot wrap, the origin pans within the columns not used by the mode
+	uint8_t colMax = 0;
+	if(VGAmode != TextMode) colMax = scrBufWidthInTile - getscrViewWidthInTile() - 1;
+	TileColScroll = (col > colMax) ? colMax : col;
+	if ((TileColScroll == colMax) && (xScroll == 7)) xScroll = 6;
+	setTileScroll(row);
+}
+
+#ifdef RASTER_EFFECTS
+void APLcore::setRowScroll(uint8_t row, uint8_t pixels) {
+	if (row >= scrViewHeight) return;
+	uint8_t colMax = 0;
+	uint8_t fine = 0;
+	if(VGAmode != TextMode) colMax = scrBufWidthInTile - getscrViewWidthInTile() - 1;
+#ifndef NO_XSCROLLING
+	if(VGAmode != TextMode) fine = pixels & 0b111;
+#endif
+	uint8_t col = pixels / TilePixWidth;
+	if (col >= colMax) {
+		col = colMax;
+		if (fine == 7) fine = 6;	// no tile column to alternate with
+	}
+	rowScroll[row] = (col << 3) | fine;	// atomic, applied at the next row begin
+}
+
+void APLcore::clearRowScroll() {
+	for (uint8_t row = 0; row < scrViewHeightInTileMax; row++) rowScroll[row] = 0xff;
+}
+
+void APLcore::setScrollSplit(uint8_t row) {
+	if (row >= scrViewHeight) row = 0;
+	TileSplit = row * TileMemHeight;
+}
+
+void APLcore::setRowColor(uint8_t row, uint8_t color) {
+	if (row >= scrViewHeight) return;
+#ifndef PIXEL_HW_MUX
+	if ((VGAmode == TextMode) || (rowMode[row] == TextMode)) {
+		if ((color != RED) && (color != GREEN) && (color != BLUE)) color = 0;	// only monochrome
+	}
+#endif
+	rowColor[row] = colorPins(color);	// atomic, applied at the next row begin
+}
+
+#ifndef SCREEN_INDEX_MAP
+#pragma GCC push_options
+#pragma GCC optimize ("O0") // avoid optimization to ensure volatile variable proprieties
+void APLcore::setLineMap(uint8_t* map) {
+	// critical section
+	lineMapMutex = 1;	// set the mutex
+	lineMapNext = map;
+	lineMapMutex = 0;	// release the mutex
+}
+#pragma GCC pop_options
+
+void APLcore::setRowMode(uint8_t row, uint8_t mode) {
+	if (row >= scrViewHeight) return;
+#ifdef PIXEL_HW_MUX
+	if ((mode != TextMode) && (mode != GraphMode)) mode = Disabled;
+#else
+	if ((mode != TextMode) && (mode != GraphPgmMode) && (mode != GraphMode)) mode = Disabled;
+	if ((mode == TextMode) && (rowColor[row] == 0)) setRowColor(row, GREEN);	// mono text color and font
+#endif
+	rowMode[row] = mode;	// atomic, applied at the next row begin
+}
+#endif
+#endif
+
+#pragma GCC push_options
+#pragma GCC optimize ("O0") // avoid optimization to ensure volatile variable proprieties
+#ifdef RASTER_EFFECTS
+void APLcore::setRasterCallback(RasterCallback callback, uint8_t line, uint8_t every) {
+	// critical section
+	rasterMutex = 1;	// set the mutex
+	rasterCallback = callback;
+	rasterLine = line;
+	rasterEvery = every;
+	rasterCycles = 0;
+	rasterOverrun = 0;
+	rasterMutex = 0;	// release the mutex
+}
+
+unsigned int APLcore::getRasterCycles() {
+	unsigned int cycles = rasterCycles; // shadowing
+	while (cycles != rasterCycles) {cycles = rasterCycles;};
+	return cycles;
+}
+
+uint8_t APLcore::getRasterOverrun() {
+	return rasterOverrun;
+}
+#endif
+
+void APLcore::setActiveRows(uint8_t first, uint8_t count) {
+	if (first >= scrViewHeight) first = 0;
+	if (count > scrViewHeight - first) count = scrViewHeight - first;
+	// critical section
+	activeMutex = 1;	// set the mutex
+	activeLineFirst = first * TileMemHeight;
+	activeLineEnd = (first + count) * TileMemHeight;
+	activeMutex = 0;	// release the mutex
+}
+
+void APLcore::waitLine() {
+	idleLine();
+}
+
+#ifdef ISR_PROFILE
+unsigned long APLcore::getMainCycles() {
+	unsigned long cycles = mainCycles; // shadowing
+	while (cycles != mainCycles) {cycles = mainCycles;};
+	return cycles;
+}
+
+unsigned long APLcore::getPhaseCycles(uint8_t phase) {
+	if (phase > PhaseBlank) return 0;
+	unsigned long cycles = phaseCycles[phase]; // shadowing
+	while (cycles != phaseCycles[phase]) {cycles = phaseCycles[phase];};
+	return cycles;
+}
+#endif
+#pragma GCC pop_options
+
 #pragma GCC push_options
 #pragma GCC optimize ("O0") // avoid optimization to ensure volatile variable proprieties
 bool APLcore::setRAMSound(uint8_t* str) {
@@ -1050,7 +2177,7 @@ char APLcore::UARTpeek() {
 #pragma GCC optimize ("O0") // avoid optimization to ensure volatile variable proprieties
 void APLcore::ms_delay(unsigned int t) {
   unsigned long tEnd = ms_elpased() + t;
-  while(tEnd > ms_elpased());
+  while(tEnd > ms_elpased()) idleLine();
 }
 
 unsigned long APLcore::ms_elpased() {
@@ -29,7 +29,17 @@
 	//================================ Hardware Config (begin) ========================================//
 	#define F_CPU 32000000UL  // system clock
 	#define PIXEL_HW_MUX      // this define enables the Pixel Hardware Mux
-	//#define NO_XSCROLLING		// use this define to disable the x scrolling feature in GraphMode (1 tile resolution could increased)
+	//#define NO_XSCROLLING		// use this define to disable the x scrolling feature in GraphMode (the saved cycles may give one more tile column)
+	//#define SCREEN_INDEX_MAP	// use this define for a tile index screen buffer (half RAM, tiles from the tileset set by setTileset())
+	//#define SCREEN_DOUBLE_BUFFER	// use this define with SCREEN_INDEX_MAP to compose the screen in a back page displayed by present()
+	//#define SCANLINE_RENDER	// use this define to render GraphMode from a RAM line buffer with the sprites set by setLineSprite() (fewer GraphMode tile columns, 24 MHz at least)
+	//#define TILE_HEIGHT_16	// use this define for 8 by 16 pixels tiles (half the tile rows, the 8 pixels font lines are doubled)
+	//#define SCREEN_240_LINES	// use this define with SCREEN_INDEX_MAP to select 240 lines (30 tile rows) by initScreenBuffer(mode, verticalScaling240)
+	//#define SLEEP_SYNC		// use this define when the main loop waits in waitLine() between the lines (no Timer0 jitter fix, Timer0 left free)
+	//#define RASTER_EFFECTS	// use this define for the per tile row scrolling, color and mode, the split, the line map and the raster callback (fewer tile columns)
+	//#define RASTER_BUDGET 128	// use this define with RASTER_EFFECTS to reserve the cycles of the raster callback on every active line (fewer tile columns)
+	//#define ISR_PROFILE		// use this define to measure the ISR cycles by getPhaseCycles() and getMainCycles() (a few cycles on every line)
+	//#define VGA_TIMING VGA_640x400_70	// use this define to select the VGA timing profile (VGA_640x480_60 by default, VGA_800x600_56, VGA_640x400_70, VGA_720x400_70)
 	//================================ Hardware Config (end) ==========================================//
 #endif
 
@@ -54,48 +64,238 @@ const uint8_t SW_version_mn = 2;
 6 yellow
 7 white */
 
-#if F_CPU == 32000000UL	
-	const uint8_t scrViewWidthInTileTEXT = 29; // 22.4.21 (AS7)
+// VGA timing profiles (VGA_TIMING), the lines not rendered by the tile rows are black lines around the screen
+#define VGA_640x480_60 0
+#define VGA_800x600_56 1
+#define VGA_640x400_70 2
+#define VGA_720x400_70 3	// the 640x400 timing, the monitor samples 720 pixels (text mode)
+#ifndef VGA_TIMING
+	#define VGA_TIMING VGA_640x480_60
+#endif
+#if VGA_TIMING == VGA_800x600_56
+	#define VGA_LINE_QUS 114		// line period in quarter uS (28.5 uS)
+	#define VGA_HSYNC_QUS 8			// H-sync pulse in quarter uS
+	#define VGA_PORCH_NS 5556		// H-sync pulse and back porch
+	#define VGA_SYNC_POSITIVE 3		// bit 0: H-sync, bit 1: V-sync
+	#define VGA_VSYNC_LINES 2
+	#define VGA_VBACK_LINES 22
+	#define VGA_ACTIVE_LINES 600
+	#define VGA_VFRONT_LINES 1
+	#define VGA_FRAME_RATE 56
+	#define VGA_FRAME_MS 18
+#elif (VGA_TIMING == VGA_640x400_70) || (VGA_TIMING == VGA_720x400_70)
+	#define VGA_LINE_QUS 127
+	#define VGA_HSYNC_QUS 16
+	#define VGA_PORCH_NS 5910
+	#define VGA_SYNC_POSITIVE 2		// the V-sync polarity tells 400 lines to the monitor
+	#define VGA_VSYNC_LINES 2
+	#define VGA_VBACK_LINES 35
+	#define VGA_ACTIVE_LINES 400
+	#define VGA_VFRONT_LINES 12
+	#define VGA_FRAME_RATE 70
+	#define VGA_FRAME_MS 14
+#else
+	#define VGA_LINE_QUS 127		// 31.746 uS round-up to 31.75uS
+	#define VGA_HSYNC_QUS 16
+	#define VGA_PORCH_NS 5910
+	#define VGA_SYNC_POSITIVE 3		// positive pulses as always output by the APL
+	#define VGA_VSYNC_LINES 2
+	#define VGA_VBACK_LINES 33
+	#define VGA_ACTIVE_LINES 480
+	#define VGA_VFRONT_LINES 10
+	#define VGA_FRAME_RATE 60
+	#define VGA_FRAME_MS 17
+#endif
+
+// H-sync period in cycles (timer1 at F_CPU/8) and the tiles the blitter fits in it
+#define LINE_CYCLES (F_CPU / 8 * VGA_LINE_QUS / 4000000 * 8)
+#define BLIT_TILES(overhead, tileCycles) ((LINE_CYCLES > (overhead)) ? (LINE_CYCLES - (overhead)) / (tileCycles) : 0)
+// nop cycles before the first pixel (back porch), the ISR reaches the blitter earlier above 24 MHz or with a shorter porch than 640x480
+#define PORCH_DELAY_480 ((F_CPU > 24000000UL) ? (F_CPU - 24000000UL) * 15 / 8000000UL : 0)
+#define PORCH_SAVED (F_CPU / 1000000UL * (5910 - VGA_PORCH_NS) / 1000)
+#define PORCH_DELAY ((PORCH_DELAY_480 > PORCH_SAVED) ? PORCH_DELAY_480 - PORCH_SAVED : 0)
+// ISR cycles besides the tiles and cycles per tile: the largest residue LINE_CYCLES - tiles * cycles of the 16, 24 and 32 MHz
+// measures (the porch delay excluded), conservative for the clocks in between
+#ifdef PIXEL_HW_MUX
+	#define BLIT_OVERHEAD_TEXT (305 + PORCH_DELAY)
+	#define BLIT_OVERHEAD_GRAPH 344
+#else
+	#define BLIT_OVERHEAD_TEXT (312 + PORCH_DELAY)
+	#define BLIT_OVERHEAD_GRAPH 472
+	#define BLIT_OVERHEAD_GRAPH_PGM (393 + PORCH_DELAY)
+#endif
+#define BLIT_CYCLES_TEXT 24		// 6 pixels
+#define BLIT_CYCLES_GRAPH 32	// 8 pixels
+// GraphMode cycles saved by NO_XSCROLLING: no scrolled part tile at the line end (and no prologue without the pixel mux)
+#ifndef NO_XSCROLLING
+	#define BLIT_SAVED_GRAPH 0
+#elif defined(PIXEL_HW_MUX)
+	#define BLIT_SAVED_GRAPH 24
+#else
+	#define BLIT_SAVED_GRAPH (46 - PORCH_DELAY)
+#endif
+// ISR cycles the options add to the longest active line, not in the measures (instruction count estimates)
+#ifndef RASTER_BUDGET
+	#define RASTER_BUDGET 0
+#endif
+#ifdef RASTER_EFFECTS
+	#define BLIT_LINE_EFFECTS (120 + RASTER_BUDGET)	// tile row mode, scrolling and color, split, line map, active rows and raster callback test
+#else
+	#define BLIT_LINE_EFFECTS 0
+#endif
+#ifdef SCREEN_INDEX_MAP
+	// the buffer row (at most the width without the options) is expanded over the lines of a tile row but one
+	#if defined(SCREEN_240_LINES) && defined(TILE_HEIGHT_16)
+		#define BLIT_ROW_LINES 32
+	#elif defined(SCREEN_240_LINES)
+		#define BLIT_ROW_LINES 16
+	#elif defined(TILE_HEIGHT_16)
+		#define BLIT_ROW_LINES 48
+	#else
+		#define BLIT_ROW_LINES 24
+	#endif
+	#define BLIT_LINE_INDEX_MAP (40 + 24 * ((BLIT_TILES(BLIT_RESIDUE_TEXT, BLIT_CYCLES_TEXT) + BLIT_ROW_LINES - 2) / (BLIT_ROW_LINES - 1)))	// row buffer swap and 24 per tile index
+#else
+	#define BLIT_LINE_INDEX_MAP 0
+#endif
+#ifdef ISR_PROFILE
+	#define BLIT_LINE_PROFILE 28	// TCNT1 read and 32 bit accumulation
+#else
+	#define BLIT_LINE_PROFILE 0
+#endif
+#if defined(SCREEN_240_LINES) && defined(SCREEN_INDEX_MAP)
+	#define BLIT_LINE_240 6			// volatile scaling and buffer height
+#else
+	#define BLIT_LINE_240 0
+#endif
+#ifdef TILE_HEIGHT_16
+	#define BLIT_LINE_TILE16 6		// doubled font line offset
+#else
+	#define BLIT_LINE_TILE16 0
+#endif
+#define BLIT_OVERHEAD_LINE (BLIT_LINE_EFFECTS + BLIT_LINE_INDEX_MAP + BLIT_LINE_PROFILE + BLIT_LINE_240 + BLIT_LINE_TILE16)
+
+// the measured widths (without the options above)
+#if (F_CPU == 32000000UL) && (VGA_LINE_QUS == 127)
+	#define MEASURED_TILES_TEXT 29 // 22.4.21 (AS7)
 	#ifdef PIXEL_HW_MUX		
-		const uint8_t scrViewWidthInTileGRAPH = 21; // 12.2.21 (AS7)
+		#define MEASURED_TILES_GRAPH 21 // 12.2.21 (AS7)
 	#else		
-		const uint8_t scrViewWidthInTileGRAPH = 17; // with xscrolling 22.4.21 (AS7)
-		const uint8_t scrViewWidthInTileGRAPH_PGM = 19; // without xscrolling 22.4.21 (AS7)
+		#define MEASURED_TILES_GRAPH 17 // with xscrolling 22.4.21 (AS7)
+		#define MEASURED_TILES_GRAPH_PGM 19 // without xscrolling 22.4.21 (AS7)
 	#endif
-#elif F_CPU == 24000000UL	
+#elif (F_CPU == 24000000UL) && (VGA_LINE_QUS == 127)
 	#ifdef PIXEL_HW_MUX	
-		const uint8_t scrViewWidthInTileTEXT = 20; // 22.4.21 (AS7)	
-		const uint8_t scrViewWidthInTileGRAPH = 14; // 22.4.21 (AS7)
+		#define MEASURED_TILES_TEXT 20 // 22.4.21 (AS7)	
+		#define MEASURED_TILES_GRAPH 14 // 22.4.21 (AS7)
 	#else
-		const uint8_t scrViewWidthInTileTEXT = 19; // 22.4.21 (AS7)
-		const uint8_t scrViewWidthInTileGRAPH = 11; // with xscrolling 22.4.21 (AS7)
-		const uint8_t scrViewWidthInTileGRAPH_PGM = 13; // without xscrolling 22.4.21 (AS7)
+		#define MEASURED_TILES_TEXT 19 // 22.4.21 (AS7)
+		#define MEASURED_TILES_GRAPH 11 // with xscrolling 22.4.21 (AS7)
+		#define MEASURED_TILES_GRAPH_PGM 13 // without xscrolling 22.4.21 (AS7)
 	#endif
-#elif F_CPU == 20000000UL
-	const uint8_t scrViewWidthInTileTEXT = ??;
-	const uint8_t scrViewWidthInTileGRAPH = ??;
-#else 	// Arduino default 16 MHz
+#elif (F_CPU == 16000000UL) && (VGA_LINE_QUS == 127)	// Arduino default
 	#ifdef PIXEL_HW_MUX	
-		const uint8_t scrViewWidthInTileTEXT = 9; // 1.5.20 (Arduino 1.8.12)
-		const uint8_t scrViewWidthInTileGRAPH = 6; // 1.5.20 (Arduino 1.8.12)
+		#define MEASURED_TILES_TEXT 9 // 1.5.20 (Arduino 1.8.12)
+		#define MEASURED_TILES_GRAPH 6 // 1.5.20 (Arduino 1.8.12)
+	#else
+		#define MEASURED_TILES_TEXT 8 // 22.4.21 (AS7)
+		#define MEASURED_TILES_GRAPH 4 // with xscrolling 22.4.21 (AS7)
+		#define MEASURED_TILES_GRAPH_PGM 6 // without xscrolling 22.4.21 (AS7)	
+	#endif
+#endif
+// ISR cycles besides the tiles: measured residue, else the conservative overhead (other clocks, e.g. 20 MHz, and line periods)
+#ifdef MEASURED_TILES_TEXT
+	#define BLIT_RESIDUE_TEXT (LINE_CYCLES - MEASURED_TILES_TEXT * BLIT_CYCLES_TEXT)
+	#define BLIT_RESIDUE_GRAPH (LINE_CYCLES - MEASURED_TILES_GRAPH * BLIT_CYCLES_GRAPH)
+	#ifndef PIXEL_HW_MUX
+		#define BLIT_RESIDUE_GRAPH_PGM (LINE_CYCLES - MEASURED_TILES_GRAPH_PGM * BLIT_CYCLES_GRAPH)
+	#endif
+#else
+	#define BLIT_RESIDUE_TEXT BLIT_OVERHEAD_TEXT
+	#define BLIT_RESIDUE_GRAPH BLIT_OVERHEAD_GRAPH
+	#ifndef PIXEL_HW_MUX
+		#define BLIT_RESIDUE_GRAPH_PGM BLIT_OVERHEAD_GRAPH_PGM
+	#endif
+#endif
+#ifdef SCANLINE_RENDER
+	// the GraphMode line buffer of the next pixel line is built in three slices, one per line of the current pixel line:
+	// the first tiles, the other tiles and a sprite span, a sprite span (instruction count estimates)
+	#ifdef PIXEL_HW_MUX
+		#define SCANLINE_TILE 36	// unrolled copy of a 4 bytes PGM tile line
+		#define SCANLINE_SPAN 160	// sprite span over 5 bytes
 	#else
-		const uint8_t scrViewWidthInTileTEXT = 8; // 22.4.21 (AS7)
-		const uint8_t scrViewWidthInTileGRAPH = 4; // with xscrolling 22.4.21 (AS7)
-		const uint8_t scrViewWidthInTileGRAPH_PGM = 6; // without xscrolling 22.4.21 (AS7)	
+		#define SCANLINE_TILE 26	// unrolled copy of a 2 bytes PGM tile line
+		#define SCANLINE_SPAN 110	// sprite span over 3 bytes
 	#endif
+	#ifdef RASTER_EFFECTS
+		#define SCANLINE_SLICE 120	// slice setup, next line split, line map, row mode and scrolling
+	#else
+		#define SCANLINE_SLICE 60	// slice setup and next line
+	#endif
+	#define SCANLINE_SELECT 40		// sprite spans of the line, in the first slice
+	// the GraphMode cycles reserved on every line for the largest slice, the first two balanced for the width left:
+	// R = SLICE + (SELECT + SPAN + (TILES + 1) * TILE) / 2 with TILES = (avail - R) / 32, and half a tile of rounding margin
+	#define SCANLINE_AVAIL (LINE_CYCLES - BLIT_RESIDUE_GRAPH - BLIT_OVERHEAD_LINE + BLIT_SAVED_GRAPH)
+	#define SCANLINE_BALANCED ((64 * SCANLINE_SLICE + 32 * (SCANLINE_SELECT + SCANLINE_SPAN + SCANLINE_TILE) + SCANLINE_AVAIL * SCANLINE_TILE) / (64 + SCANLINE_TILE) + SCANLINE_TILE / 2)
+	#define BLIT_LINE_SCANLINE ((SCANLINE_BALANCED > SCANLINE_SLICE + SCANLINE_SPAN) ? SCANLINE_BALANCED : SCANLINE_SLICE + SCANLINE_SPAN)
+#else
+	#define BLIT_LINE_SCANLINE 0
+#endif
+#define VIEW_TILES_TEXT BLIT_TILES(BLIT_RESIDUE_TEXT + BLIT_OVERHEAD_LINE, BLIT_CYCLES_TEXT)
+#define VIEW_TILES_GRAPH BLIT_TILES(BLIT_RESIDUE_GRAPH + BLIT_OVERHEAD_LINE - BLIT_SAVED_GRAPH + BLIT_LINE_SCANLINE, BLIT_CYCLES_GRAPH)
+#ifndef PIXEL_HW_MUX
+	#define VIEW_TILES_GRAPH_PGM BLIT_TILES(BLIT_RESIDUE_GRAPH_PGM + BLIT_OVERHEAD_LINE, BLIT_CYCLES_GRAPH)
+#endif
+const uint8_t scrViewWidthInTileTEXT = VIEW_TILES_TEXT;
+const uint8_t scrViewWidthInTileGRAPH = VIEW_TILES_GRAPH;
+#ifndef PIXEL_HW_MUX
+const uint8_t scrViewWidthInTileGRAPH_PGM = VIEW_TILES_GRAPH_PGM;
 #endif
 
 // APL core engine constants
-const uint8_t scrViewHeightInTile = 20;
+#ifdef TILE_HEIGHT_16
+const uint8_t scrViewHeightInTile = (VGA_ACTIVE_LINES >= 480) ? 10 : VGA_ACTIVE_LINES / (3 * 16);
+#else
+const uint8_t scrViewHeightInTile = (VGA_ACTIVE_LINES >= 480) ? 20 : VGA_ACTIVE_LINES / (3 * 8);
+#endif
 const uint8_t verticalScaling = 3;                         // repeating at each n lines
 const uint8_t scrBufWidthInTile = scrViewWidthInTileTEXT;  // TEXT mode is larger than GRAPH mode
 const uint8_t scrBufHeightInTile = scrViewHeightInTile+1;    // tiles height+1 for yscoll. The max is verticalPixels/verticalScaling/(TileMemHeight-1)
+#ifdef SCREEN_240_LINES
+const uint8_t scrViewHeightInTile240 = scrViewHeightInTile * 3 / 2;
+const uint8_t verticalScaling240 = 2;                      // 240 lines
+const uint8_t scrViewHeightInTileMax = scrViewHeightInTile240;
+#else
+const uint8_t scrViewHeightInTileMax = scrViewHeightInTile;
+#endif
+const uint8_t scrBufHeightInTileMax = scrViewHeightInTileMax+1;
 // VGAmode
 const uint8_t Disabled		= 0;
 const uint8_t TextMode		= 1;
 const uint8_t GraphPgmMode	= 2;
 const uint8_t GraphMode		= 3;
 
+// ISR phases of the lines, measured by getPhaseCycles() with ISR_PROFILE
+const uint8_t PhaseActive	= 0;	// rendered pixel lines
+const uint8_t PhaseBlank	= 1;	// black lines: porches, V sync and hidden lines
+
+// raster line callback, called by the ISR between the lines with the screen pixel line to come
+typedef void (*RasterCallback)(uint8_t line);
+const uint8_t LineBlank = 0xff;		// line map entry of a black line
+#ifdef RASTER_EFFECTS
+// cycles left by the ISR on the longest active line of each mode (RASTER_BUDGET at least), the budget is the smallest of them;
+// a longer callback stretches the ISR into the next line, whose pixels begin late
+const unsigned int RasterSlackTEXT = LINE_CYCLES - BLIT_RESIDUE_TEXT - BLIT_OVERHEAD_LINE + RASTER_BUDGET - VIEW_TILES_TEXT * BLIT_CYCLES_TEXT;
+const unsigned int RasterSlackGRAPH = LINE_CYCLES - BLIT_RESIDUE_GRAPH - BLIT_OVERHEAD_LINE + RASTER_BUDGET + BLIT_SAVED_GRAPH - BLIT_LINE_SCANLINE - VIEW_TILES_GRAPH * BLIT_CYCLES_GRAPH;
+#ifdef PIXEL_HW_MUX
+const unsigned int RasterCallbackBudget = (RasterSlackTEXT < RasterSlackGRAPH) ? RasterSlackTEXT : RasterSlackGRAPH;
+#else
+const unsigned int RasterSlackGRAPH_PGM = LINE_CYCLES - BLIT_RESIDUE_GRAPH_PGM - BLIT_OVERHEAD_LINE + RASTER_BUDGET - VIEW_TILES_GRAPH_PGM * BLIT_CYCLES_GRAPH;
+const unsigned int RasterCallbackBudgetTG = (RasterSlackTEXT < RasterSlackGRAPH) ? RasterSlackTEXT : RasterSlackGRAPH;
+const unsigned int RasterCallbackBudget = (RasterCallbackBudgetTG < RasterSlackGRAPH_PGM) ? RasterCallbackBudgetTG : RasterSlackGRAPH_PGM;
+#endif
+#endif
+
 class APLcore
 {
 	public:
@@ -112,15 +312,32 @@ class APLcore
 		void setColor(uint8_t color);
 		void initScreenBuffer(uint8_t mode);
 		void initScreenBuffer();		
+#ifdef SCREEN_240_LINES
+		void initScreenBuffer(uint8_t mode, uint8_t scaling);			///< initialize with verticalScaling (20 tile rows) or verticalScaling240 (30 tile rows)
+#endif
 		
 		uint8_t getscrViewWidthInTile();
 		uint8_t getTileMemSize();
-		uint8_t getscrViewHeightInTile() {
-				return scrViewHeightInTile; 
-		}
-		uint8_t* getTileXY(uint8_t x, uint8_t y);						///< get the pointer for the Tile at position (x,y)
-		void setRAMTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);		///< at position (x,y), set the pointer to the Tile from RAM
-		void setTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);			///< at position (x,y), set the pointer to the Tile from PGM
+		uint8_t getscrViewHeightInTile();
+		uint8_t* getTileXY(uint8_t x, uint8_t y);						///< get the pointer for the Tile at position (x,y), waits for the pending tile commands
+		bool isRAMTileXY(uint8_t x, uint8_t y);							///< true when the Tile at position (x,y) is from RAM (else PGM), waits for the pending tile commands
+		void setRAMTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);		///< at position (x,y), set the pointer to the Tile from RAM (with SCREEN_INDEX_MAP, ignored out of the RAM tileset)
+		void setTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);			///< at position (x,y), set the pointer to the Tile from PGM (with SCREEN_INDEX_MAP, ignored out of the PGM tileset indexes below ramFirstIndex)
+		bool trySetRAMTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);	///< same as setRAMTileXY() without waiting, returns false when the tile queue is full
+		bool trySetTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);		///< same as setTileXY() without waiting, returns false when the tile queue is full
+		bool isTileQueueEmpty();										///< returns true when all tile commands are applied to the screen
+#ifdef SCREEN_INDEX_MAP
+		void setTileset(const uint8_t* pgmTileset, uint8_t* ramTileset, uint8_t ramFirstIndex);	///< tile indexes below ramFirstIndex are from the PGM tileset, the others from the RAM tileset
+		void setTilesetOdd(const uint8_t* pgmTileset, uint8_t* ramTileset);	///< tilesets of the odd frames for temporal dithering, a tile index shows its tile of each tileset alternately (NULL for none, reset by setTileset())
+		uint8_t getTileIndexXY(uint8_t x, uint8_t y);					///< get the tile index at position (x,y)
+		void setTileIndexXY(uint8_t x, uint8_t y, uint8_t index);		///< at position (x,y), set the tile index
+#endif
+#ifdef SCREEN_DOUBLE_BUFFER
+		void present(bool keepFrame = true);							///< display the composed back page at the next frame begin, keepFrame copies it back for incremental updates
+#endif
+		void fillTiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t* TilePtr);	///< fill the w by h tiles area at position (x,y) with the Tile from PGM (ignored like setTileXY())
+		void blitTileMap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* indexMap, uint8_t srcW, const uint8_t* tileset, uint8_t tileSize);	///< set the w by h tiles area from the top left of the srcW tiles wide PGM index map (consecutive tiles when NULL) of the PGM tileset
+		void copyTiles(uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h, uint8_t dstX, uint8_t dstY);	///< copy the w by h tiles area from (srcX,srcY) to (dstX,dstY), overlapping allowed
 		void shiftLeftTile();
 		void shiftRightTile();
 		void shiftUpTile();
@@ -128,9 +345,34 @@ class APLcore
 		void setTileXYtext(uint8_t x, uint8_t y, char c);	
 		void setCursor(uint8_t x, uint8_t y, bool active);
 		void setCursorXY(uint8_t x, uint8_t y);
-		void setXScroll(uint8_t scrollValue);
+		void setXScroll(uint8_t scrollValue);							///< x scrolling from 0 to 7 px, the blitter scrolls by 2 px and an odd value alternates the two neighbor steps on each frame
 		void setYScroll(uint8_t scrollValue);
-		void setTileScroll(uint8_t scrollValue);
+		void setTileScroll(uint8_t scrollValue);						///< set the screen buffer row displayed on top, the rows wrap around (no copy)
+		void scrollUp(uint8_t pixels);									///< scroll the screen up by pixels, carried into setTileScroll() at each TileMemHeight, e.g. a console filling the spare row below the screen
+		uint8_t getBufferRow(uint8_t viewRow);							///< screen buffer row displayed at the screen tile row viewRow (getscrViewHeightInTile() for the spare row)
+		void setScrollOrigin(uint8_t col, uint8_t row);					///< set the screen buffer tile displayed on the top left (col limited to the unused buffer columns)
+#ifdef RASTER_EFFECTS
+		void setRowScroll(uint8_t row, uint8_t pixels);					///< set the horizontal scrolling in pixels of the screen tile row, instead of setXScroll() and the origin column
+		void clearRowScroll();											///< all screen tile rows back to setXScroll() and the origin column
+		void setScrollSplit(uint8_t row);								///< the screen tile rows from row are displayed from the same buffer rows without vertical scrolling, 0 for none
+		void setRowColor(uint8_t row, uint8_t color);					///< set the color mask of the screen tile row (0 for the screen color), setTileXYtext() uses the font of the row color
+#ifndef SCREEN_INDEX_MAP
+		void setLineMap(uint8_t* map);									///< RAM table of LineMapSize source pixel lines from the scroll origin (LineBlank for black) to zoom, mirror or roll the screen, NULL for none
+		void setRowMode(uint8_t row, uint8_t mode);						///< set the VGA mode of the screen tile row (Disabled for the screen mode), e.g. a text console below the graphics
+#endif
+		void setRasterCallback(RasterCallback callback, uint8_t line, uint8_t every);	///< call back before the screen pixel line and then each every lines (0 for once per frame), NULL removes it
+		unsigned int getRasterCycles();									///< longest raster callback measured in cycles (0xffff when it reached the next line)
+		uint8_t getRasterOverrun();										///< count of the raster callbacks longer than RasterCallbackBudget (they delay the next line, see RASTER_BUDGET)
+#endif
+		void setActiveRows(uint8_t first, uint8_t count);				///< render only count screen tile rows from first, the black lines leave most of their time to the main loop
+#ifdef ISR_PROFILE
+		unsigned long getMainCycles();									///< cycles left to the main loop during the last frame
+		unsigned long getPhaseCycles(uint8_t phase);					///< ISR cycles spent in the PhaseActive or PhaseBlank lines during the last frame
+#endif
+		void waitLine();												///< with SLEEP_SYNC, idle sleep until the next line (the lines begun during the sleep have no pixel jitter), no effect otherwise
+#ifdef SCANLINE_RENDER
+		void setLineSprite(uint8_t id, const uint8_t* image, uint8_t x, uint8_t y);	///< GraphMode sprite from PGM (NULL hides it) at pixel x of the rendered line and pixel line y of the screen buffer, the first 2 sprites of a line are drawn
+#endif
 		bool setRAMSound(uint8_t* str);									///< set sound to be played
 		bool setSound(uint8_t* str);									///< set sound to be played
 		bool setTone(uint8_t tone, uint8_t duration);
@@ -167,118 +409,138 @@ class APLcore
 		}
 	private:
 		void setColor(uint8_t color, uint8_t mode);
+		void fillScreenBuffer(const uint8_t* pgmTileset, uint8_t tileSize, const uint8_t* evenTile, const uint8_t* oddTile);
+#ifdef SCREEN_INDEX_MAP
+		void setTileset(const uint8_t* pgmTileset, uint8_t* ramTileset, uint8_t ramFirstIndex, uint8_t tileSize);
+#endif
 	private:
 		uint8_t* pFont;
 		uint8_t screenColor;
 };
 
+#ifdef TILE_HEIGHT_16
+const uint8_t TileMemHeight = 16; // TileMemHeight needs to be a pow2.
+#define TILE_ROW(...) __VA_ARGS__, __VA_ARGS__,	// the core tile rows are doubled
+#else
+const uint8_t TileMemHeight = 8; // TileMemHeight needs to be a pow2.
+#define TILE_ROW(...) __VA_ARGS__,
+#endif
+
 // 8 px width by 8 px height per byte, the out sequence is MSB to LSB
 // for Graph mode (HwMux) or GraphPGM mode (no HwMux)
 const uint8_t coreTile4B[] PROGMEM = {
   // tile 0 (empty)
-  0b00000000,0b00000000,0b00000000,0b00000000,
-  0b00000000,0b00000000,0b00000000,0b00000000,
-  0b00000000,0b00000000,0b00000000,0b00000000,
-  0b00000000,0b00000000,0b00000000,0b00000000,
-  0b00000000,0b00000000,0b00000000,0b00000000,
-  0b00000000,0b00000000,0b00000000,0b00000000,
-  0b00000000,0b00000000,0b00000000,0b00000000,
-  0b00000000,0b00000000,0b00000000,0b00000000,
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
+  TILE_ROW(0b00000000,0b00000000,0b00000000,0b00000000)
   // tile 1 (WHITE damier)
-  0b11100000,0b11100000,0b11100000,0b11100000,
-  0b00011100,0b00011100,0b00011100,0b00011100,
-  0b11100000,0b11100000,0b11100000,0b11100000,
-  0b00011100,0b00011100,0b00011100,0b00011100,
-  0b11100000,0b11100000,0b11100000,0b11100000,
-  0b00011100,0b00011100,0b00011100,0b00011100,
-  0b11100000,0b11100000,0b11100000,0b11100000,
-  0b00011100,0b00011100,0b00011100,0b00011100,
+  TILE_ROW(0b11100000,0b11100000,0b11100000,0b11100000)
+  TILE_ROW(0b00011100,0b00011100,0b00011100,0b00011100)
+  TILE_ROW(0b11100000,0b11100000,0b11100000,0b11100000)
+  TILE_ROW(0b00011100,0b00011100,0b00011100,0b00011100)
+  TILE_ROW(0b11100000,0b11100000,0b11100000,0b11100000)
+  TILE_ROW(0b00011100,0b00011100,0b00011100,0b00011100)
+  TILE_ROW(0b11100000,0b11100000,0b11100000,0b11100000)
+  TILE_ROW(0b00011100,0b00011100,0b00011100,0b00011100)
   // tile 2 (WHITE square)
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11100000,0b00000000,0b00000000,0b00011100,
-  0b11100000,0b00000000,0b00000000,0b00011100,
-  0b11100000,0b00000000,0b00000000,0b00011100,
-  0b11100000,0b00000000,0b00000000,0b00011100,
-  0b11100000,0b00000000,0b00000000,0b00011100,
-  0b11100000,0b00000000,0b00000000,0b00011100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11100000,0b00000000,0b00000000,0b00011100)
+  TILE_ROW(0b11100000,0b00000000,0b00000000,0b00011100)
+  TILE_ROW(0b11100000,0b00000000,0b00000000,0b00011100)
+  TILE_ROW(0b11100000,0b00000000,0b00000000,0b00011100)
+  TILE_ROW(0b11100000,0b00000000,0b00000000,0b00011100)
+  TILE_ROW(0b11100000,0b00000000,0b00000000,0b00011100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
   // tile 3 (WHITE full)
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
-  0b11111100,0b11111100,0b11111100,0b11111100,
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
+  TILE_ROW(0b11111100,0b11111100,0b11111100,0b11111100)
   // tile 4 (RGB damier)
-  0b11100000,0b10011000,0b01001100,0b00110100,
-  0b10011000,0b01001100,0b00110100,0b11100000,
-  0b11100000,0b10011000,0b01001100,0b00110100,
-  0b10011000,0b01001100,0b00110100,0b11100000,
-  0b11100000,0b10011000,0b01001100,0b00110100,
-  0b10011000,0b01001100,0b00110100,0b11100000,
-  0b11100000,0b10011000,0b01001100,0b00110100,
-  0b10011000,0b01001100,0b00110100,0b11100000
+  TILE_ROW(0b11100000,0b10011000,0b01001100,0b00110100)
+  TILE_ROW(0b10011000,0b01001100,0b00110100,0b11100000)
+  TILE_ROW(0b11100000,0b10011000,0b01001100,0b00110100)
+  TILE_ROW(0b10011000,0b01001100,0b00110100,0b11100000)
+  TILE_ROW(0b11100000,0b10011000,0b01001100,0b00110100)
+  TILE_ROW(0b10011000,0b01001100,0b00110100,0b11100000)
+  TILE_ROW(0b11100000,0b10011000,0b01001100,0b00110100)
+  TILE_ROW(0b10011000,0b01001100,0b00110100,0b11100000)
 }; 
 
 #ifdef PIXEL_HW_MUX
 // color 8 pixels by 8 pixels tile.
 // 4 double px width by 8 px height "R0,G0,B0,R1,G1,B1,x,x"
 const uint8_t TileMemWidth = 4;  // halved because double pix per byte
-const uint8_t TileMemHeight = 8; // TileMemHeight needs to be a pow2.
 const uint8_t TileMemSize = TileMemWidth*TileMemHeight;
 const uint8_t TileMemSize4B = TileMemWidth*TileMemHeight;
+const uint8_t TilePixBits = 3;		// RGB pixel, the first pixel in the MSB
+const uint8_t TilePixPerByte = 2;
 
 #else
 const uint8_t TileMemWidth = 2;  // 2 byte for 8 pix (monochrome 8 pixels by 8 pixels tile.)
 const uint8_t TileMemWidth4B = 4;  // 4 byte for 8 pix (8 colors PGM Tile only in GraphMode)
-const uint8_t TileMemHeight = 8; // TileMemHeight needs to be a pow2.
 const uint8_t TileMemSize = TileMemWidth*TileMemHeight;
 const uint8_t TileMemSize4B = TileMemWidth4B*TileMemHeight;
+const uint8_t TilePixBits = 2;		// 4 colors pixel (GraphMode), the first pixel in the MSB
+const uint8_t TilePixPerByte = 4;
 
 // 8 px width by 8 px height 2 bytes, 4 colors (RED|GREEN)
 // for Graph mode (no HwMux)
 const uint8_t coreTile2B[] __attribute__ ((aligned(32))) PROGMEM = {
   // tile 0 (empty)
-  0b00000000, 0b00000000,
-  0b00000000, 0b00000000,
-  0b00000000, 0b00000000,
-  0b00000000, 0b00000000,
-  0b00000000, 0b00000000,
-  0b00000000, 0b00000000,
-  0b00000000, 0b00000000,
-  0b00000000, 0b00000000,
+  TILE_ROW(0b00000000, 0b00000000)
+  TILE_ROW(0b00000000, 0b00000000)
+  TILE_ROW(0b00000000, 0b00000000)
+  TILE_ROW(0b00000000, 0b00000000)
+  TILE_ROW(0b00000000, 0b00000000)
+  TILE_ROW(0b00000000, 0b00000000)
+  TILE_ROW(0b00000000, 0b00000000)
+  TILE_ROW(0b00000000, 0b00000000)
   // tile 1 (checkboard)
-  0b01100110, 0b01100110,
-  0b10011001, 0b10011001,
-  0b01100110, 0b01100110,
-  0b10011001, 0b10011001,
-  0b01100110, 0b01100110,
-  0b10011001, 0b10011001,
-  0b01100110, 0b01100110,
-  0b10011001, 0b10011001,
+  TILE_ROW(0b01100110, 0b01100110)
+  TILE_ROW(0b10011001, 0b10011001)
+  TILE_ROW(0b01100110, 0b01100110)
+  TILE_ROW(0b10011001, 0b10011001)
+  TILE_ROW(0b01100110, 0b01100110)
+  TILE_ROW(0b10011001, 0b10011001)
+  TILE_ROW(0b01100110, 0b01100110)
+  TILE_ROW(0b10011001, 0b10011001)
   // tile 2 (square)
-  0b11111111, 0b11111111,
-  0b11000000, 0b00000011,
-  0b11000000, 0b00000011,
-  0b11000000, 0b00000011,
-  0b11000000, 0b00000011,
-  0b11000000, 0b00000011,
-  0b11000000, 0b00000011,
-  0b11111111, 0b11111111,
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11000000, 0b00000011)
+  TILE_ROW(0b11000000, 0b00000011)
+  TILE_ROW(0b11000000, 0b00000011)
+  TILE_ROW(0b11000000, 0b00000011)
+  TILE_ROW(0b11000000, 0b00000011)
+  TILE_ROW(0b11000000, 0b00000011)
+  TILE_ROW(0b11111111, 0b11111111)
   // tile 3 (full)
-  0b11111111, 0b11111111,
-  0b11111111, 0b11111111,
-  0b11111111, 0b11111111,
-  0b11111111, 0b11111111,
-  0b11111111, 0b11111111,
-  0b11111111, 0b11111111,
-  0b11111111, 0b11111111,
-  0b11111111, 0b11111111
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11111111, 0b11111111)
+  TILE_ROW(0b11111111, 0b11111111)
 };  
 //  end of APL tiles
 #endif
+const uint8_t TilePixMask = (1 << TilePixBits) - 1;
+const uint8_t TilePixWidth = TileMemWidth * TilePixPerByte;	// 8 pixels
+inline uint8_t tilePixShift(uint8_t x) {	// bit position of the pixel x in its byte
+	return 8 - TilePixBits * (1 + (x & (TilePixPerByte-1)));
+}
+const uint8_t LineMapSize = scrViewHeightInTile * TileMemHeight;	// line map entries, one per screen pixel line
 
 // BASIC tone table: index = f/4, F in Hz
 const uint8_t BASIC_sound[] PROGMEM = {
@@ -0,0 +1,189 @@
+/***************************************************************************************************/
+/*                                                                                                 */
+/* file:          APLsprite.cpp                                                                    */
+/*                                                                                                 */
+/* source:        2018-2025, written by Adrian Kundert (adrian.kundert@gmail.com)                  */
+/*                                                                                                 */
+/* description:   APL software sprites composed into a pool of RAM tiles                           */
+/*                                                                                                 */
+/* This library is free software; you can redistribute it and/or modify it under the terms of the  */
+/* GNU Lesser General Public License as published by the Free Software Foundation;                 */
+/* either version 2.1 of the License, or (at your option) any later version.                       */
+/*                                                                                                 */
+/* This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;       */
+/* without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.       */
+/* See the GNU Lesser General Public License for more details.                                     */
+/*                                                                                                 */
+/***************************************************************************************************/
+
+#ifdef ATMEL_STUDIO
+	#include <avr/pgmspace.h>
+	#define NULL 0
+#endif
+#include "APLsprite.h"
+
+#pragma GCC optimize ("-O3") // speed optimization
+
+APLsprite::APLsprite(APLcore* pAPL) {
+	this->pAPL = pAPL;
+	for (uint8_t s = 0; s < SpriteMax; s++) {
+		sprite[s].image = NULL;
+		sprite[s].x = sprite[s].y = 0;
+		collision[s] = 0;
+	}
+	for (uint8_t e = 0; e < SpritePoolSize; e++) {
+		pool[e].shown = pool[e].next = 0;
+		pool[e].refresh = false;
+	}
+	dirty = 0;
+}
+
+void APLsprite::setSprite(uint8_t id, const uint8_t* image) {
+	if (id >= SpriteMax) return;
+	if (sprite[id].image != image) {
+		sprite[id].image = image;
+		dirty |= 1 << id;
+	}
+}
+
+void APLsprite::moveSprite(uint8_t id, uint8_t x, uint8_t y) {
+	if (id >= SpriteMax) return;
+	if ((sprite[id].x != x) || (sprite[id].y != y)) {
+		sprite[id].x = x;
+		sprite[id].y = y;
+		dirty |= 1 << id;
+	}
+}
+
+uint8_t APLsprite::getCollision(uint8_t id) {
+	if (id >= SpriteMax) return 0;
+	return collision[id];
+}
+
+// returns SpritePoolSize when the tile has no sprite
+uint8_t APLsprite::findEntry(uint8_t x, uint8_t y) {
+	for (uint8_t e = 0; e < SpritePoolSize; e++) {
+		if (((pool[e].shown | pool[e].next) != 0) && (pool[e].x == x) && (pool[e].y == y)) return e;
+	}
+	return SpritePoolSize;
+}
+
+uint8_t* APLsprite::getTileXY(uint8_t x, uint8_t y) {
+	uint8_t e = findEntry(x, y);
+	if (e < SpritePoolSize) return pool[e].background;
+	return pAPL->getTileXY(x, y);
+}
+
+void APLsprite::setTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr) {
+	setBackground(x, y, TilePtr, false);
+}
+
+void APLsprite::setRAMTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr) {
+	setBackground(x, y, TilePtr, true);
+}
+
+void APLsprite::setBackground(uint8_t x, uint8_t y, uint8_t* TilePtr, bool ram) {
+	uint8_t e = findEntry(x, y);
+	if (e < SpritePoolSize) {
+		pool[e].background = TilePtr;	// composed at the next update
+		pool[e].ram = ram;
+		pool[e].refresh = true;
+	}
+	else if (ram) pAPL->setRAMTileXY(x, y, TilePtr);
+	else pAPL->setTileXY(x, y, TilePtr);
+}
+
+void APLsprite::update() {
+	for (uint8_t s = 0; s < SpriteMax; s++) {
+		if (dirty & (1 << s)) collision[s] = 0;	// evaluated again by the composition
+	}
+
+	// assign the tiles covered by the sprites to the pool entries
+	for (uint8_t e = 0; e < SpritePoolSize; e++) pool[e].next = 0;
+	uint8_t viewWidth = pAPL->getscrViewWidthInTile();
+	uint8_t viewHeight = pAPL->getscrViewHeightInTile();
+	for (uint8_t s = 0; s < SpriteMax; s++) {
+		if (sprite[s].image == NULL) continue;
+		uint8_t x0 = sprite[s].x / TilePixWidth, x1 = (sprite[s].x + TilePixWidth-1) / TilePixWidth;
+		uint8_t y0 = sprite[s].y / TileMemHeight, y1 = (sprite[s].y + TileMemHeight-1) / TileMemHeight;
+		for (uint8_t y = y0; (y <= y1) && (y < viewHeight); y++) {
+			for (uint8_t x = x0; (x <= x1) && (x < viewWidth); x++) {
+				uint8_t e = findEntry(x, y);
+				if (e == SpritePoolSize) {
+					// new sprite tile, the entries left at this update are free at the next one
+					for (e = 0; e < SpritePoolSize; e++) {
+						if ((pool[e].shown | pool[e].next) == 0) break;
+					}
+					if (e == SpritePoolSize) continue;	// pool exhausted
+					pool[e].x = x;
+					pool[e].y = y;
+					pool[e].background = pAPL->getTileXY(x, y);
+					pool[e].ram = pAPL->isRAMTileXY(x, y);
+					pool[e].refresh = true;
+				}
+				pool[e].next |= 1 << s;
+			}
+		}
+	}
+
+	// only the dirty tiles are updated
+	for (uint8_t e = 0; e < SpritePoolSize; e++) {
+		PoolEntry* pEntry = &pool[e];
+		if (pEntry->next == 0) {
+			if (pEntry->shown != 0) {
+				// restore the background as it was read
+				if (pEntry->ram) pAPL->setRAMTileXY(pEntry->x, pEntry->y, pEntry->background);
+				else pAPL->setTileXY(pEntry->x, pEntry->y, pEntry->background);
+			}
+			pEntry->shown = 0;
+		}
+		else if (pEntry->refresh || (pEntry->next != pEntry->shown) || (pEntry->next & dirty)) {
+			composeTile(e);
+			if (pEntry->shown == 0) pAPL->setRAMTileXY(pEntry->x, pEntry->y, poolTile[e]);
+			pEntry->shown = pEntry->next;
+			pEntry->refresh = false;
+		}
+	}
+	dirty = 0;
+}
+
+void APLsprite::composeTile(uint8_t e) {
+	PoolEntry* pEntry = &pool[e];
+	uint8_t back[TileMemSize];	// background read as stored, RAM or PGM
+	uint8_t tile[TileMemSize];	// composed aside, keeps the pool tile short of the intermediate states
+	for (uint8_t i = 0; i < TileMemSize; i++) {
+		back[i] = pEntry->ram ? pEntry->background[i] : pgm_read_byte(pEntry->background + i);
+		tile[i] = back[i];
+	}
+
+	for (uint8_t s = 0; s < SpriteMax; s++) {
+		if ((pEntry->next & (1 << s)) == 0) continue;
+		Sprite* pSprite = &sprite[s];
+		uint8_t bit = 1 << (((pEntry->x > pSprite->x / TilePixWidth) ? 1 : 0) + ((pEntry->y > pSprite->y / TileMemHeight) ? 2 : 0));
+		collision[s] &= ~bit;	// evaluated again against the current background
+		// sprite origin in the tile, between -7 and 7
+		int dx = (int)pSprite->x - (int)pEntry->x * TilePixWidth;
+		int dy = (int)pSprite->y - (int)pEntry->y * TileMemHeight;
+		uint8_t colFirst = (dx > 0) ? dx : 0;
+		uint8_t colEnd = (dx < 0) ? TilePixWidth + dx : TilePixWidth;
+		uint8_t rowFirst = (dy > 0) ? dy : 0;
+		uint8_t rowEnd = (dy < 0) ? TileMemHeight + dy : TileMemHeight;
+		for (uint8_t row = rowFirst; row < rowEnd; row++) {
+			const uint8_t* pSrc = pSprite->image + (row - dy) * TileMemWidth;
+			const uint8_t* pBack = &back[row * TileMemWidth];
+			uint8_t* pDst = &tile[row * TileMemWidth];
+			for (uint8_t col = colFirst; col < colEnd; col++) {
+				uint8_t sx = col - dx;
+				uint8_t pix = (pgm_read_byte(pSrc + sx / TilePixPerByte) >> tilePixShift(sx)) & TilePixMask;
+				if (pix == 0) continue;	// transparent
+				uint8_t shift = tilePixShift(col);
+				if ((pBack[col / TilePixPerByte] >> shift) & TilePixMask) collision[s] |= bit;
+				pDst[col / TilePixPerByte] = (pDst[col / TilePixPerByte] & ~(TilePixMask << shift)) | (pix << shift);
+			}
+		}
+	}
+
+	// the pool tile may be on the screen, a frame can still show it half copied
+	uint8_t* pPool = poolTile[e];
+	for (uint8_t i = 0; i < TileMemSize; i++) pPool[i] = tile[i];
+}
@@ -0,0 +1,70 @@
+/***************************************************************************************************/
+/*                                                                                                 */
+/* file:          APLsprite.h                                                                      */
+/*                                                                                                 */
+/* source:        2018-2025, written by Adrian Kundert (adrian.kundert@gmail.com)                  */
+/*                                                                                                 */
+/* description:   APL software sprites composed into a pool of RAM tiles                           */
+/*                                                                                                 */
+/* This library is free software; you can redistribute it and/or modify it under the terms of the  */
+/* GNU Lesser General Public License as published by the Free Software Foundation;                 */
+/* either version 2.1 of the License, or (at your option) any later version.                       */
+/*                                                                                                 */
+/* This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;       */
+/* without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.       */
+/* See the GNU Lesser General Public License for more details.                                     */
+/*                                                                                                 */
+/***************************************************************************************************/
+
+#ifndef APLsprite_h
+#define APLsprite_h
+
+#include "APLcore.h"
+
+// The sprite image is a PGM tile of GraphMode (TileMemSize bytes, black pixels are transparent).
+// The sprites are drawn over PGM or RAM background tiles, a sprite straddles up to 4 screen tiles.
+// With SCREEN_INDEX_MAP, the pool tiles must be the RAM tileset (see getPoolTiles()).
+// The composed tile is copied over the pool tile in place, a moving sprite may tear for one frame.
+class APLsprite
+{
+	public:
+		static const uint8_t SpriteMax = 4;			// 8 max (sprite bit mask)
+		static const uint8_t SpritePoolSize = 8;	// RAM tiles, the sprite tiles beyond the pool are not drawn
+
+		APLsprite(APLcore* pAPL);
+		void setSprite(uint8_t id, const uint8_t* image);				///< set the PGM image of the sprite, NULL hides the sprite
+		void moveSprite(uint8_t id, uint8_t x, uint8_t y);				///< set the pixel position of the sprite top left corner
+		void update();													///< compose the dirty sprite tiles and restore the tiles left, call once per frame
+		uint8_t getCollision(uint8_t id);								///< bit 0 to 3 set for the top left, top right, bottom left, bottom right tile where the sprite hits non black background pixels
+		uint8_t* getTileXY(uint8_t x, uint8_t y);						///< get the background tile at position (x,y), also under the sprites
+		void setTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);			///< at position (x,y), set the background tile from PGM, also under the sprites
+		void setRAMTileXY(uint8_t x, uint8_t y, uint8_t* TilePtr);		///< at position (x,y), set the background tile from RAM, also under the sprites
+		uint8_t* getPoolTiles() {
+			return &poolTile[0][0];
+		}
+	private:
+		struct Sprite {
+			const uint8_t* image;
+			uint8_t x, y;		// pixel position
+		};
+		struct PoolEntry {
+			uint8_t x, y;		// tile position
+			uint8_t* background;// tile restored when the sprites leave
+			bool ram;			// background from RAM, else PGM
+			uint8_t shown;		// sprite bit mask composed on the screen
+			uint8_t next;		// sprite bit mask of the current update
+			bool refresh;		// background changed
+		};
+		uint8_t findEntry(uint8_t x, uint8_t y);
+		void setBackground(uint8_t x, uint8_t y, uint8_t* TilePtr, bool ram);
+		void composeTile(uint8_t e);
+	private:
+		APLcore* pAPL;
+		Sprite sprite[SpriteMax];
+		uint8_t collision[SpriteMax];
+		uint8_t dirty;			// sprite bit mask moved or changed since the last update
+		PoolEntry pool[SpritePoolSize];
+		uint8_t poolTile[SpritePoolSize][TileMemSize];
+};
+
+#endif
@@ -2591,6 +2591,1289 @@ const uint8_t PETtile2B[] PROGMEM = {
 
 #endif
 
+//--- PETSCII glyphs, 1 bit per pixel for the attribute tiles (APLattr) ----------------------------
+const uint8_t PETglyph1B[] PROGMEM = {
+	/* PET:00 */
+	0b00011100,	/*    ???   */
+	0b00100010,	/*   ?   ?  */
+	0b01001010,	/*  ?  ? ?  */
+	0b01010110,	/*  ? ? ??  */
+	0b01001100,	/*  ?  ??   */
+	0b00100000,	/*   ?      */
+	0b00011110,	/*    ????  */
+	0b00000000,	/*          */
+	
+	/* PET:01 */
+	0b00011000,	/*    ??    */
+	0b00100100,	/*   ?  ?   */
+	0b01000010,	/*  ?    ?  */
+	0b01111110,	/*  ??????  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:02 */
+	0b01111100,	/*  ?????   */
+	0b00100010,	/*   ?   ?  */
+	0b00100010,	/*   ?   ?  */
+	0b00111100,	/*   ????   */
+	0b00100010,	/*   ?   ?  */
+	0b00100010,	/*   ?   ?  */
+	0b01111100,	/*  ?????   */
+	0b00000000,	/*          */
+	
+	/* PET:03 */
+	0b00011100,	/*    ???   */
+	0b00100010,	/*   ?   ?  */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b00100010,	/*   ?   ?  */
+	0b00011100,	/*    ???   */
+	0b00000000,	/*          */
+	
+	/* PET:04 */
+	0b01111000,	/*  ????    */
+	0b00100100,	/*   ?  ?   */
+	0b00100010,	/*   ?   ?  */
+	0b00100010,	/*   ?   ?  */
+	0b00100010,	/*   ?   ?  */
+	0b00100100,	/*   ?  ?   */
+	0b01111000,	/*  ????    */
+	0b00000000,	/*          */
+	
+	/* PET:05 */
+	0b01111110,	/*  ??????  */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01111000,	/*  ????    */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01111110,	/*  ??????  */
+	0b00000000,	/*          */
+	
+	/* PET:06 */
+	0b01111110,	/*  ??????  */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01111000,	/*  ????    */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b00000000,	/*          */
+	
+	/* PET:07 */
+	0b00011100,	/*    ???   */
+	0b00100010,	/*   ?   ?  */
+	0b01000000,	/*  ?       */
+	0b01001110,	/*  ?  ???  */
+	0b01000010,	/*  ?    ?  */
+	0b00100010,	/*   ?   ?  */
+	0b00011100,	/*    ???   */
+	0b00000000,	/*          */
+	
+	/* PET:08 */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01111110,	/*  ??????  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:09 */
+	0b00011100,	/*    ???   */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00011100,	/*    ???   */
+	0b00000000,	/*          */
+	
+	/* PET:0A */
+	0b00001110,	/*     ???  */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b01000100,	/*  ?   ?   */
+	0b00111000,	/*   ???    */
+	0b00000000,	/*          */
+	
+	/* PET:0B */
+	0b01000010,	/*  ?    ?  */
+	0b01000100,	/*  ?   ?   */
+	0b01001000,	/*  ?  ?    */
+	0b01110000,	/*  ???     */
+	0b01001000,	/*  ?  ?    */
+	0b01000100,	/*  ?   ?   */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:0C */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01111110,	/*  ??????  */
+	0b00000000,	/*          */
+	
+	/* PET:0D */
+	0b01000010,	/*  ?    ?  */
+	0b01100110,	/*  ??  ??  */
+	0b01011010,	/*  ? ?? ?  */
+	0b01011010,	/*  ? ?? ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:0E */
+	0b01000010,	/*  ?    ?  */
+	0b01100010,	/*  ??   ?  */
+	0b01010010,	/*  ? ?  ?  */
+	0b01001010,	/*  ?  ? ?  */
+	0b01000110,	/*  ?   ??  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:0F */
+	0b00011000,	/*    ??    */
+	0b00100100,	/*   ?  ?   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00100100,	/*   ?  ?   */
+	0b00011000,	/*    ??    */
+	0b00000000,	/*          */
+	
+	/* PET:10 */
+	0b01111100,	/*  ?????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01111100,	/*  ?????   */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b00000000,	/*          */
+	
+	/* PET:11 */
+	0b00011000,	/*    ??    */
+	0b00100100,	/*   ?  ?   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01001010,	/*  ?  ? ?  */
+	0b00100100,	/*   ?  ?   */
+	0b00011010,	/*    ?? ?  */
+	0b00000000,	/*          */
+	
+	/* PET:12 */
+	0b01111100,	/*  ?????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01111100,	/*  ?????   */
+	0b01001000,	/*  ?  ?    */
+	0b01000100,	/*  ?   ?   */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:13 */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000000,	/*  ?       */
+	0b00111100,	/*   ????   */
+	0b00000010,	/*       ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:14 */
+	0b00111110,	/*   ?????  */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:15 */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:16 */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00100100,	/*   ?  ?   */
+	0b00100100,	/*   ?  ?   */
+	0b00011000,	/*    ??    */
+	0b00011000,	/*    ??    */
+	0b00000000,	/*          */
+	
+	/* PET:17 */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01011010,	/*  ? ?? ?  */
+	0b01011010,	/*  ? ?? ?  */
+	0b01100110,	/*  ??  ??  */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:18 */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00100100,	/*   ?  ?   */
+	0b00011000,	/*    ??    */
+	0b00100100,	/*   ?  ?   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00000000,	/*          */
+	
+	/* PET:19 */
+	0b00100010,	/*   ?   ?  */
+	0b00100010,	/*   ?   ?  */
+	0b00100010,	/*   ?   ?  */
+	0b00011100,	/*    ???   */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:1A */
+	0b01111110,	/*  ??????  */
+	0b00000010,	/*       ?  */
+	0b00000100,	/*      ?   */
+	0b00011000,	/*    ??    */
+	0b00100000,	/*   ?      */
+	0b01000000,	/*  ?       */
+	0b01111110,	/*  ??????  */
+	0b00000000,	/*          */
+	
+	/* PET:1B */
+	0b00111100,	/*   ????   */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:1C */
+	0b00000000,	/*          */
+	0b01000000,	/*  ?       */
+	0b00100000,	/*   ?      */
+	0b00010000,	/*    ?     */
+	0b00001000,	/*     ?    */
+	0b00000100,	/*      ?   */
+	0b00000010,	/*       ?  */
+	0b00000000,	/*          */
+	
+	/* PET:1D */
+	0b00111100,	/*   ????   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:1E */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00011100,	/*    ???   */
+	0b00101010,	/*   ? ? ?  */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:1F */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00010000,	/*    ?     */
+	0b00100000,	/*   ?      */
+	0b01111111,	/*  ??????? */
+	0b00100000,	/*   ?      */
+	0b00010000,	/*    ?     */
+	0b00000000,	/*          */
+	
+	/* PET:20 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:21 */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:22 */
+	0b00100100,	/*   ?  ?   */
+	0b00100100,	/*   ?  ?   */
+	0b00100100,	/*   ?  ?   */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:23 */
+	0b00100100,	/*   ?  ?   */
+	0b00100100,	/*   ?  ?   */
+	0b01111110,	/*  ??????  */
+	0b00100100,	/*   ?  ?   */
+	0b01111110,	/*  ??????  */
+	0b00100100,	/*   ?  ?   */
+	0b00100100,	/*   ?  ?   */
+	0b00000000,	/*          */
+	
+	/* PET:24 */
+	0b00001000,	/*     ?    */
+	0b00011110,	/*    ????  */
+	0b00101000,	/*   ? ?    */
+	0b00011100,	/*    ???   */
+	0b00001010,	/*     ? ?  */
+	0b00111100,	/*   ????   */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:25 */
+	0b00000000,	/*          */
+	0b01100010,	/*  ??   ?  */
+	0b01100100,	/*  ??  ?   */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b00100110,	/*   ?  ??  */
+	0b01000110,	/*  ?   ??  */
+	0b00000000,	/*          */
+	
+	/* PET:26 */
+	0b00110000,	/*   ??     */
+	0b01001000,	/*  ?  ?    */
+	0b01001000,	/*  ?  ?    */
+	0b00110000,	/*   ??     */
+	0b01001010,	/*  ?  ? ?  */
+	0b01000100,	/*  ?   ?   */
+	0b00111010,	/*   ??? ?  */
+	0b00000000,	/*          */
+	
+	/* PET:27 */
+	0b00000100,	/*      ?   */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:28 */
+	0b00000100,	/*      ?   */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00001000,	/*     ?    */
+	0b00000100,	/*      ?   */
+	0b00000000,	/*          */
+	
+	/* PET:29 */
+	0b00100000,	/*   ?      */
+	0b00010000,	/*    ?     */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b00100000,	/*   ?      */
+	0b00000000,	/*          */
+	
+	/* PET:2A */
+	0b00001000,	/*     ?    */
+	0b00101010,	/*   ? ? ?  */
+	0b00011100,	/*    ???   */
+	0b00111110,	/*   ?????  */
+	0b00011100,	/*    ???   */
+	0b00101010,	/*   ? ? ?  */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:2B */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00111110,	/*   ?????  */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:2C */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	
+	/* PET:2D */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b01111110,	/*  ??????  */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:2E */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00011000,	/*    ??    */
+	0b00011000,	/*    ??    */
+	0b00000000,	/*          */
+	
+	/* PET:2F */
+	0b00000000,	/*          */
+	0b00000010,	/*       ?  */
+	0b00000100,	/*      ?   */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b00100000,	/*   ?      */
+	0b01000000,	/*  ?       */
+	0b00000000,	/*          */
+	
+	/* PET:30 */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000110,	/*  ?   ??  */
+	0b01011010,	/*  ? ?? ?  */
+	0b01100010,	/*  ??   ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:31 */
+	0b00001000,	/*     ?    */
+	0b00011000,	/*    ??    */
+	0b00101000,	/*   ? ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00111110,	/*   ?????  */
+	0b00000000,	/*          */
+	
+	/* PET:32 */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b00000010,	/*       ?  */
+	0b00001100,	/*     ??   */
+	0b00110000,	/*   ??     */
+	0b01000000,	/*  ?       */
+	0b01111110,	/*  ??????  */
+	0b00000000,	/*          */
+	
+	/* PET:33 */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b00000010,	/*       ?  */
+	0b00011100,	/*    ???   */
+	0b00000010,	/*       ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:34 */
+	0b00000100,	/*      ?   */
+	0b00001100,	/*     ??   */
+	0b00010100,	/*    ? ?   */
+	0b00100100,	/*   ?  ?   */
+	0b01111110,	/*  ??????  */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000000,	/*          */
+	
+	/* PET:35 */
+	0b01111110,	/*  ??????  */
+	0b01000000,	/*  ?       */
+	0b01111000,	/*  ????    */
+	0b00000100,	/*      ?   */
+	0b00000010,	/*       ?  */
+	0b01000100,	/*  ?   ?   */
+	0b00111000,	/*   ???    */
+	0b00000000,	/*          */
+	
+	/* PET:36 */
+	0b00011100,	/*    ???   */
+	0b00100000,	/*   ?      */
+	0b01000000,	/*  ?       */
+	0b01111100,	/*  ?????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:37 */
+	0b01111110,	/*  ??????  */
+	0b01000010,	/*  ?    ?  */
+	0b00000100,	/*      ?   */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00000000,	/*          */
+	
+	/* PET:38 */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:39 */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111110,	/*   ?????  */
+	0b00000010,	/*       ?  */
+	0b00000100,	/*      ?   */
+	0b00111000,	/*   ???    */
+	0b00000000,	/*          */
+	
+	/* PET:3A */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:3B */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	
+	/* PET:3C */
+	0b00001110,	/*     ???  */
+	0b00011000,	/*    ??    */
+	0b00110000,	/*   ??     */
+	0b01100000,	/*  ??      */
+	0b00110000,	/*   ??     */
+	0b00011000,	/*    ??    */
+	0b00001110,	/*     ???  */
+	0b00000000,	/*          */
+	
+	/* PET:3D */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b01111110,	/*  ??????  */
+	0b00000000,	/*          */
+	0b01111110,	/*  ??????  */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:3E */
+	0b01110000,	/*  ???     */
+	0b00011000,	/*    ??    */
+	0b00001100,	/*     ??   */
+	0b00000110,	/*      ??  */
+	0b00001100,	/*     ??   */
+	0b00011000,	/*    ??    */
+	0b01110000,	/*  ???     */
+	0b00000000,	/*          */
+	
+	/* PET:3F */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b00000010,	/*       ?  */
+	0b00001100,	/*     ??   */
+	0b00010000,	/*    ?     */
+	0b00000000,	/*          */
+	0b00010000,	/*    ?     */
+	0b00000000,	/*          */
+	
+	/* PET:40 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:41 */
+	0b00001000,	/*     ?    */
+	0b00011100,	/*    ???   */
+	0b00111110,	/*   ?????  */
+	0b01111111,	/*  ??????? */
+	0b01111111,	/*  ??????? */
+	0b00011100,	/*    ???   */
+	0b00111110,	/*   ?????  */
+	0b00000000,	/*          */
+	
+	/* PET:42 */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	0b00010000,	/*    ?     */
+	
+	/* PET:43 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:44 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:45 */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:46 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:47 */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	0b00100000,	/*   ?      */
+	
+	/* PET:48 */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	0b00000100,	/*      ?   */
+	
+	/* PET:49 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11100000,	/* ???      */
+	0b00010000,	/*    ?     */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:4A */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00000100,	/*      ?   */
+	0b00000011,	/*       ?? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:4B */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b11100000,	/* ???      */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:4C */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b11111111,	/* ???????? */
+	
+	/* PET:4D */
+	0b10000000,	/* ?        */
+	0b01000000,	/*  ?       */
+	0b00100000,	/*   ?      */
+	0b00010000,	/*    ?     */
+	0b00001000,	/*     ?    */
+	0b00000100,	/*      ?   */
+	0b00000010,	/*       ?  */
+	0b00000001,	/*        ? */
+	
+	/* PET:4E */
+	0b00000001,	/*        ? */
+	0b00000010,	/*       ?  */
+	0b00000100,	/*      ?   */
+	0b00001000,	/*     ?    */
+	0b00010000,	/*    ?     */
+	0b00100000,	/*   ?      */
+	0b01000000,	/*  ?       */
+	0b10000000,	/* ?        */
+	
+	/* PET:4F */
+	0b11111111,	/* ???????? */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	
+	/* PET:50 */
+	0b11111111,	/* ???????? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	
+	/* PET:51 */
+	0b00000000,	/*          */
+	0b00111100,	/*   ????   */
+	0b01111110,	/*  ??????  */
+	0b01111110,	/*  ??????  */
+	0b01111110,	/*  ??????  */
+	0b01111110,	/*  ??????  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:52 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	
+	/* PET:53 */
+	0b00110110,	/*   ?? ??  */
+	0b01111111,	/*  ??????? */
+	0b01111111,	/*  ??????? */
+	0b01111111,	/*  ??????? */
+	0b00111110,	/*   ?????  */
+	0b00011100,	/*    ???   */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:54 */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	0b01000000,	/*  ?       */
+	
+	/* PET:55 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000011,	/*       ?? */
+	0b00000100,	/*      ?   */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:56 */
+	0b10000001,	/* ?      ? */
+	0b01000010,	/*  ?    ?  */
+	0b00100100,	/*   ?  ?   */
+	0b00011000,	/*    ??    */
+	0b00011000,	/*    ??    */
+	0b00100100,	/*   ?  ?   */
+	0b01000010,	/*  ?    ?  */
+	0b10000001,	/* ?      ? */
+	
+	/* PET:57 */
+	0b00000000,	/*          */
+	0b00111100,	/*   ????   */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b01000010,	/*  ?    ?  */
+	0b00111100,	/*   ????   */
+	0b00000000,	/*          */
+	
+	/* PET:58 */
+	0b00001000,	/*     ?    */
+	0b00011100,	/*    ???   */
+	0b00101010,	/*   ? ? ?  */
+	0b01110111,	/*  ??? ??? */
+	0b00101010,	/*   ? ? ?  */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:59 */
+	0b00000010,	/*       ?  */
+	0b00000010,	/*       ?  */
+	0b00000010,	/*       ?  */
+	0b00000010,	/*       ?  */
+	0b00000010,	/*       ?  */
+	0b00000010,	/*       ?  */
+	0b00000010,	/*       ?  */
+	0b00000010,	/*       ?  */
+	
+	/* PET:5A */
+	0b00001000,	/*     ?    */
+	0b00011100,	/*    ???   */
+	0b00111110,	/*   ?????  */
+	0b01111111,	/*  ??????? */
+	0b00111110,	/*   ?????  */
+	0b00011100,	/*    ???   */
+	0b00001000,	/*     ?    */
+	0b00000000,	/*          */
+	
+	/* PET:5B */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b11111111,	/* ???????? */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:5C */
+	0b10100000,	/* ? ?      */
+	0b01010000,	/*  ? ?     */
+	0b10100000,	/* ? ?      */
+	0b01010000,	/*  ? ?     */
+	0b10100000,	/* ? ?      */
+	0b01010000,	/*  ? ?     */
+	0b10100000,	/* ? ?      */
+	0b01010000,	/*  ? ?     */
+	
+	/* PET:5D */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:5E */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000001,	/*        ? */
+	0b00111110,	/*   ?????  */
+	0b01010100,	/*  ? ? ?   */
+	0b00010100,	/*    ? ?   */
+	0b00010100,	/*    ? ?   */
+	0b00000000,	/*          */
+	
+	/* PET:5F */
+	0b11111111,	/* ???????? */
+	0b01111111,	/*  ??????? */
+	0b00111111,	/*   ?????? */
+	0b00011111,	/*    ????? */
+	0b00001111,	/*     ???? */
+	0b00000111,	/*      ??? */
+	0b00000011,	/*       ?? */
+	0b00000001,	/*        ? */
+	
+	/* PET:60 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:61 */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	
+	/* PET:62 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	
+	/* PET:63 */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:64 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	
+	/* PET:65 */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	0b10000000,	/* ?        */
+	
+	/* PET:66 */
+	0b10101010,	/* ? ? ? ?  */
+	0b01010101,	/*  ? ? ? ? */
+	0b10101010,	/* ? ? ? ?  */
+	0b01010101,	/*  ? ? ? ? */
+	0b10101010,	/* ? ? ? ?  */
+	0b01010101,	/*  ? ? ? ? */
+	0b10101010,	/* ? ? ? ?  */
+	0b01010101,	/*  ? ? ? ? */
+	
+	/* PET:67 */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	
+	/* PET:68 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b10101010,	/* ? ? ? ?  */
+	0b01010101,	/*  ? ? ? ? */
+	0b10101010,	/* ? ? ? ?  */
+	0b01010101,	/*  ? ? ? ? */
+	
+	/* PET:69 */
+	0b11111111,	/* ???????? */
+	0b11111110,	/* ???????  */
+	0b11111100,	/* ??????   */
+	0b11111000,	/* ?????    */
+	0b11110000,	/* ????     */
+	0b11100000,	/* ???      */
+	0b11000000,	/* ??       */
+	0b10000000,	/* ?        */
+	
+	/* PET:6A */
+	0b00000011,	/*       ?? */
+	0b00000011,	/*       ?? */
+	0b00000011,	/*       ?? */
+	0b00000011,	/*       ?? */
+	0b00000011,	/*       ?? */
+	0b00000011,	/*       ?? */
+	0b00000011,	/*       ?? */
+	0b00000011,	/*       ?? */
+	
+	/* PET:6B */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001111,	/*     ???? */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:6C */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	
+	/* PET:6D */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001111,	/*     ???? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:6E */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111000,	/* ?????    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:6F */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	
+	/* PET:70 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00001111,	/*     ???? */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:71 */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:72 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:73 */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b11111000,	/* ?????    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	
+	/* PET:74 */
+	0b11000000,	/* ??       */
+	0b11000000,	/* ??       */
+	0b11000000,	/* ??       */
+	0b11000000,	/* ??       */
+	0b11000000,	/* ??       */
+	0b11000000,	/* ??       */
+	0b11000000,	/* ??       */
+	0b11000000,	/* ??       */
+	
+	/* PET:75 */
+	0b11100000,	/* ???      */
+	0b11100000,	/* ???      */
+	0b11100000,	/* ???      */
+	0b11100000,	/* ???      */
+	0b11100000,	/* ???      */
+	0b11100000,	/* ???      */
+	0b11100000,	/* ???      */
+	0b11100000,	/* ???      */
+	
+	/* PET:76 */
+	0b00000111,	/*      ??? */
+	0b00000111,	/*      ??? */
+	0b00000111,	/*      ??? */
+	0b00000111,	/*      ??? */
+	0b00000111,	/*      ??? */
+	0b00000111,	/*      ??? */
+	0b00000111,	/*      ??? */
+	0b00000111,	/*      ??? */
+	
+	/* PET:77 */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:78 */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:79 */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	0b11111111,	/* ???????? */
+	
+	/* PET:7A */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b00000001,	/*        ? */
+	0b11111111,	/* ???????? */
+	
+	/* PET:7B */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	
+	/* PET:7C */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:7D */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b00001000,	/*     ?    */
+	0b11111000,	/* ?????    */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:7E */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	0b00000000,	/*          */
+	
+	/* PET:7F */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b11110000,	/* ????     */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	0b00001111,	/*     ???? */
+	0b00001111	/*     ???? */
+};  //  end of glyphs
+
 //--------------------------------------------------------------------------------------------------
 
 #endif